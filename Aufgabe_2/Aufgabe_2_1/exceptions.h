@@ -18,4 +18,9 @@ public:
     using ErrorSortiment::ErrorSortiment;
 };
 
+class ErrorTreeFile : public std::runtime_error {
+public:
+    using std::runtime_error::runtime_error;
+};
+
 #endif //AUFGABE_1_EXCEPTIONS_H
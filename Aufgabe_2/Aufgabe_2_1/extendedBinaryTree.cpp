@@ -1,7 +1,15 @@
 #include "extendedBinaryTree.h"
 #include <iostream>
+#include <vector>
+#include <future>
+#include <thread>
+#include <algorithm>
 
 Ware* BinaryTree::insert(Ware * key) {
+    if(this->rootNode == nullptr) {
+        this->rootNode = key;
+        return key;
+    }
     return this->rootNode->insert(key);
 }
 
@@ -18,8 +26,25 @@ Ware* BinaryTree::search(Ware * key) {
     return node;
 }
 
+//  returns the first Ware found with exactly this Verkaufspreis, nullptr if there is none
+Ware* BinaryTree::search(double verkaufspreis) {
+    Ware* node = this->rootNode;
+    while(node != nullptr && node->getVerkaufspreis() != verkaufspreis) {
+        if(verkaufspreis > node->getVerkaufspreis()) {
+            node = node->right;
+        } else {
+            node = node->left;
+        }
+    }
+    return node;
+}
+
+//  deletes the first Ware with the Verkaufspreis of key, returns the new root
 Ware* BinaryTree::deleteItem(Ware* key) {
-    return this->rootNode->deleteItem(key);
+    if(this->rootNode != nullptr) {
+        this->rootNode = this->rootNode->deleteItem(key);
+    }
+    return this->rootNode;
 }
 
 //Not in use and not tested
@@ -38,6 +63,77 @@ Ware* BinaryTree::findMax(Ware* node) {
     return node;
 }
 
+int BinaryTree::getHeight(Ware* node) {
+    if(node == nullptr) {
+        return 0;
+    }
+    return 1 + std::max(getHeight(node->left), getHeight(node->right));
+}
+
+int BinaryTree::getHeight() {
+    return getHeight(this->rootNode);
+}
+
+//  Below this many Ware a subtree is built on the current thread, starting a thread would cost more than it saves
+static const int parallelBuildCutoff = 1 << 14;
+
+/*  The middle element of [start, end) becomes the root, the halves left and right of it become the subtrees.
+    As long as threadDepth > 0 the left half is built on a new thread while the current thread builds the right half.
+    Both halves write to disjoint Ware, so no synchronisation is needed besides waiting for the left half.
+ */
+Ware* BinaryTree::buildBalanced(Ware* waren[], int start, int end, int threadDepth) {
+    if(start >= end) {
+        return nullptr;
+    }
+    int middle = start + (end - start) / 2;
+    Ware* node = waren[middle];
+
+    if(threadDepth > 0 && end - start > parallelBuildCutoff) {
+        auto leftHalf = std::async(std::launch::async, buildBalanced, waren, start, middle, threadDepth - 1);
+        node->right = buildBalanced(waren, middle + 1, end, threadDepth - 1);
+        node->left = leftHalf.get();
+    } else {
+        node->left = buildBalanced(waren, start, middle, 0);
+        node->right = buildBalanced(waren, middle + 1, end, 0);
+    }
+    return node;
+}
+
+BinaryTree BinaryTree::buildFromSorted(Ware* waren[], int size) {
+    //  every level of threads doubles the number of threads: depth = log2(number of cores)
+    int threadDepth = 0;
+    for(unsigned int cores = std::thread::hardware_concurrency(); cores > 1; cores /= 2) {
+        threadDepth++;
+    }
+
+    BinaryTree tree;
+    tree.rootNode = buildBalanced(waren, 0, size, threadDepth);
+    return tree;
+}
+
+void BinaryTree::insertBatch(Ware* waren[], int size) {
+    //  collect the tree in-order with an explicit stack; single inserts may have degenerated it to a list
+    std::vector<Ware*> inorder;
+    std::vector<Ware*> stack;
+    Ware* node = this->rootNode;
+    while(node != nullptr || !stack.empty()) {
+        while(node != nullptr) {
+            stack.push_back(node);
+            node = node->left;
+        }
+        node = stack.back();
+        stack.pop_back();
+        inorder.push_back(node);
+        node = node->right;
+    }
+
+    std::vector<Ware*> merged(inorder.size() + size);
+    std::merge(inorder.begin(), inorder.end(), waren, waren + size, merged.begin(),
+               [](const Ware* a, const Ware* b) { return a->getVerkaufspreis() < b->getVerkaufspreis(); });
+
+    *this = buildFromSorted(merged.data(), (int)merged.size());
+}
+
 /*Pre-order, NLR
     Visit the current node (in the figure: position red).
     Recursively traverse the current node's left subtree.
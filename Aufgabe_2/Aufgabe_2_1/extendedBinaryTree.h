@@ -1,3 +1,6 @@
+#ifndef AUFGABE_2_1_EXTENDEDBINARYTREE_H
+#define AUFGABE_2_1_EXTENDEDBINARYTREE_H
+
 #include "extendedBinaryTreeNode.h"
 #include <string>
 #include <sstream>
@@ -6,16 +9,31 @@ class BinaryTree {
     public:
     Ware* rootNode;
 
+        BinaryTree() {
+            this->rootNode = nullptr;
+        };
+
         BinaryTree(Ware * test) {
             Ware* root = test;
             this->rootNode = root;
         };
 
         Ware* search(Ware * key);
+        Ware* search(double verkaufspreis);
         Ware* insert(Ware* key);
-        Ware* deleteItem(Ware* key);
+        Ware* deleteItem(Ware* key);    //  deletes the first Ware with the Verkaufspreis of key
         Ware* findMin(Ware* node);
         Ware* findMax(Ware* node);
+        int getHeight();
+
+        /*  --
+            Bulk construction from an array sorted by Verkaufspreis:
+            buildFromSorted links the Ware into a perfectly balanced tree in O(n), the two halves of the upper
+            levels are built on separate threads. insertBatch merges a sorted batch with the in-order sequence
+            of the tree and rebuilds it balanced in O(n + k).
+        --  */
+        static BinaryTree buildFromSorted(Ware* waren[], int size);
+        void insertBatch(Ware* waren[], int size);
 
         //Further information's: https://en.wikipedia.org/wiki/Tree_traversal#In-order_(LNR)
         std::string printPreorder(Ware* node);
@@ -24,4 +42,10 @@ class BinaryTree {
         std::string printPostorder();
         std::string printInorder(Ware* node);
         std::string printInorder();
+
+    private:
+        static Ware* buildBalanced(Ware* waren[], int start, int end, int threadDepth);
+        static int getHeight(Ware* node);
 };
+
+#endif //AUFGABE_2_1_EXTENDEDBINARYTREE_H
@@ -120,36 +120,39 @@ Ware* Ware::insert(Ware * value) {
     return this;
 }
 
-//Deleting and rearranging three
+//Deleting and rearranging three, returns the new root of the subtree (nullptr if it is empty now)
 Ware* Ware::deleteItem(Ware * value) {
-    Ware* node = this;
-
-    if(node == nullptr) {
+    if(value->getVerkaufspreis() < this->getVerkaufspreis()) {
+        if(this->left != nullptr) {
+            this->left = this->left->deleteItem(value);
+        }
         return this;
-    } else if(value->getVerkaufspreis() < node->getVerkaufspreis()) {
-        node->left = node->left->deleteItem(value);
-    } else if(value->getVerkaufspreis() > node->getVerkaufspreis()) {
-        node->right = node->right->deleteItem(value);
-    } else {
-        if(node->left == nullptr && node->right == nullptr) {
-            delete node;
-            node = nullptr;
-        } else if(node->left == nullptr) { // only children in right subtree
-            Ware* temp = node;
-            node = node->right;
-            delete temp;
-        } else if(this->right == nullptr) { // only children in left subtree
-            Ware* temp = node;
-            node = node->left;
-            delete temp;
-        } else { // we have to keep the BST structure, here, we look for the minimum in the right subtree (see lecture)
-            Ware* temp = node->right;
-            while(temp->left != nullptr) {
-                temp = temp->left;
-            }
-            node->key = temp->key;
-            node->right = node->right->deleteItem(temp);
+    }
+    if(value->getVerkaufspreis() > this->getVerkaufspreis()) {
+        if(this->right != nullptr) {
+            this->right = this->right->deleteItem(value);
         }
+        return this;
+    }
+
+    if(this->left == nullptr || this->right == nullptr) { // at most one child, it takes the place of this node
+        Ware* child = this->left != nullptr ? this->left : this->right;
+        delete this;
+        return child;
     }
-    return node;
-}
\ No newline at end of file
+    // we have to keep the BST structure, here, we look for the minimum in the right subtree (see lecture)
+    // and relink it in place of this node, the data of the Ware is never copied
+    Ware* parent = this;
+    Ware* successor = this->right;
+    while(successor->left != nullptr) {
+        parent = successor;
+        successor = successor->left;
+    }
+    if(parent != this) {
+        parent->left = successor->right;
+        successor->right = this->right;
+    }
+    successor->left = this->left;
+    delete this;
+    return successor;
+}
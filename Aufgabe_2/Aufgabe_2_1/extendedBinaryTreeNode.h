@@ -8,14 +8,15 @@
 #include <string>
 #include <iostream>
 #include <map>
+#include <utility>
 #include "binders.h"
 
 
 class Ware {
 
 private:
-    //Name pool for random creation of products
-    std::string name_array[10] = {"Schwert", "Trank", "Kraeuter", "Pilz", "Stein", "Fisch",
+    //Name pool for random creation of products; static, so millions of Ware do not carry ten strings each
+    static inline const std::string name_array[10] = {"Schwert", "Trank", "Kraeuter", "Pilz", "Stein", "Fisch",
                                   "Blume", "Fleisch", "Salz", "Pelz" };
     std::string bezeichnung;
     int seriennummer;
@@ -36,6 +37,14 @@ public:
         this->right = nullptr;
     };
 
+    Ware(std::string bezeichnung, int seriennummer, double gewicht, double einkaufspreis, double verkaufspreis) :
+    bezeichnung(std::move(bezeichnung)), seriennummer(seriennummer), gewicht(gewicht),
+    einkaufspreis(einkaufspreis), verkaufspreis(verkaufspreis){
+        this->key = nullptr;
+        this->left = nullptr;
+        this->right = nullptr;
+    };
+
     ~Ware() {};
 
     const std::string &getBezeichnung() const;
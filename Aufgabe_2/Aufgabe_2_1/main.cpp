@@ -2,7 +2,10 @@
 #include <iostream>
 #include <iomanip>
 #include <vector>
+#include <algorithm>
+#include <chrono>
 #include "extendedBinaryTree.h"
+#include "treeFile.h"
 
 
 int main() {
@@ -43,4 +46,47 @@ int main() {
     std::cout << "Node [1] deleted" << std::endl;
     std::cout << "\nPrint in Preorder \n" << christmasTree.printPreorder() << std::endl;
 
-}
\ No newline at end of file
+
+    //  --  Bulk build of a balanced tree from one million Ware sorted by Verkaufspreis  --
+    auto byPrice = [](const Ware* a, const Ware* b) { return a->getVerkaufspreis() < b->getVerkaufspreis(); };
+    std::vector<Ware*> warehouse(1000000);
+    for(auto & i : warehouse){
+        i = new Ware;
+    }
+    std::sort(warehouse.begin(), warehouse.end(), byPrice);
+
+    auto start = std::chrono::steady_clock::now();
+    BinaryTree priceIndex = BinaryTree::buildFromSorted(warehouse.data(), (int)warehouse.size());
+    auto end = std::chrono::steady_clock::now();
+    std::cout << "Bulk build of " << warehouse.size() << " Ware: height " << priceIndex.getHeight() << ", "
+              << std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count() << " ms" << std::endl;
+
+    //  --  Merge a sorted batch into the existing tree in one pass  --
+    std::vector<Ware*> batch(100000);
+    for(auto & i : batch){
+        i = new Ware;
+    }
+    std::sort(batch.begin(), batch.end(), byPrice);
+    priceIndex.insertBatch(batch.data(), (int)batch.size());
+    std::cout << "Batch of " << batch.size() << " Ware inserted: height " << priceIndex.getHeight() << std::endl;
+
+    //  --  Save the tree, map it as read-only index and rebuild the pointer tree from it  --
+    saveTree(priceIndex, "priceIndex.bst");
+    MappedWareIndex mappedIndex("priceIndex.bst");
+    const WareRecord* record = mappedIndex.search(warehouse[500000]->getVerkaufspreis());
+    std::cout << "Mapped index with " << mappedIndex.size() << " records, found " << record->bezeichnung
+              << " for Verkaufspreis " << record->verkaufspreis << std::endl;
+
+    start = std::chrono::steady_clock::now();
+    BinaryTree reloaded = loadTree("priceIndex.bst");
+    end = std::chrono::steady_clock::now();
+    std::cout << "Reloaded tree: height " << reloaded.getHeight() << ", "
+              << std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count() << " ms" << std::endl;
+
+    for(auto & i : warehouse){
+        delete i;
+    }
+    for(auto & i : batch){
+        delete i;
+    }
+}
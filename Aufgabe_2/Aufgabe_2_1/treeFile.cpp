@@ -0,0 +1,236 @@
+#include "treeFile.h"
+#include "exceptions.h"
+#include <cstring>
+#include <fstream>
+#include <vector>
+#include <algorithm>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+static const char treeFileMagic[4] = {'B', 'S', 'T', '1'};
+
+MappedFile::MappedFile(const std::string& path) {
+    int fd = open(path.c_str(), O_RDONLY);
+    if(fd == -1) {
+        throw ErrorTreeFile("Could not open " + path);
+    }
+    struct stat info{};
+    if(fstat(fd, &info) == -1 || info.st_size == 0) {
+        close(fd);
+        throw ErrorTreeFile("Could not read " + path);
+    }
+    void* mapping = mmap(nullptr, info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);  //  the mapping stays valid after closing the descriptor
+    if(mapping == MAP_FAILED) {
+        throw ErrorTreeFile("Could not map " + path);
+    }
+    this->data = static_cast<const unsigned char*>(mapping);
+    this->size = info.st_size;
+}
+
+MappedFile::~MappedFile() {
+    munmap(const_cast<unsigned char*>(this->data), this->size);
+}
+
+const unsigned char* MappedFile::getData() const {
+    return this->data;
+}
+
+size_t MappedFile::getSize() const {
+    return this->size;
+}
+
+//  checks header and file size, returns the number of nodes and the start of the records and structure bits
+static uint64_t readTreeFile(const MappedFile& file, const WareRecord*& records, const unsigned char*& structure) {
+    if(file.getSize() < sizeof(TreeFileHeader)) {
+        throw ErrorTreeFile("Tree file too short");
+    }
+    TreeFileHeader header{};
+    std::memcpy(&header, file.getData(), sizeof(header));
+    if(std::memcmp(header.magic, treeFileMagic, sizeof(treeFileMagic)) != 0 || header.recordSize != sizeof(WareRecord)) {
+        throw ErrorTreeFile("Not a Ware tree file");
+    }
+    //  bound nodeCount by the bytes after the header first, so that the size below can not wrap around
+    if(header.nodeCount > (file.getSize() - sizeof(TreeFileHeader)) / sizeof(WareRecord)) {
+        throw ErrorTreeFile("Tree file has the wrong size");
+    }
+    uint64_t expectedSize = sizeof(TreeFileHeader) + header.nodeCount * sizeof(WareRecord) + (header.nodeCount + 3) / 4;
+    if(file.getSize() != expectedSize) {
+        throw ErrorTreeFile("Tree file has the wrong size");
+    }
+    records = reinterpret_cast<const WareRecord*>(file.getData() + sizeof(TreeFileHeader));
+    structure = file.getData() + sizeof(TreeFileHeader) + header.nodeCount * sizeof(WareRecord);
+    return header.nodeCount;
+}
+
+void saveTree(const BinaryTree& tree, const std::string& path) {
+    std::vector<WareRecord> records;
+    std::vector<unsigned char> structure;
+
+    //  structure bits in preorder
+    std::vector<const Ware*> stack;
+    if(tree.rootNode != nullptr) {
+        stack.push_back(tree.rootNode);
+    }
+    uint64_t count = 0;
+    while(!stack.empty()) {
+        const Ware* node = stack.back();
+        stack.pop_back();
+        unsigned char bits = (node->left != nullptr ? 1 : 0) | (node->right != nullptr ? 2 : 0);
+        if(count % 4 == 0) {
+            structure.push_back(0);
+        }
+        structure.back() |= bits << (2 * (count % 4));
+        count++;
+
+        if(node->right != nullptr) {
+            stack.push_back(node->right);
+        }
+        if(node->left != nullptr) {
+            stack.push_back(node->left);
+        }
+    }
+
+    //  records in-order
+    records.reserve(count);
+    const Ware* node = tree.rootNode;
+    while(node != nullptr || !stack.empty()) {
+        while(node != nullptr) {
+            stack.push_back(node);
+            node = node->left;
+        }
+        node = stack.back();
+        stack.pop_back();
+
+        if(node->getBezeichnung().size() >= sizeof(WareRecord::bezeichnung)) {
+            throw ErrorTreeFile("Bezeichnung too long for the tree file: " + node->getBezeichnung());
+        }
+        WareRecord record{};
+        std::strcpy(record.bezeichnung, node->getBezeichnung().c_str());
+        record.seriennummer = node->getSeriennummer();
+        record.gewicht = node->getGewicht();
+        record.einkaufspreis = node->getEinkaufspreis();
+        record.verkaufspreis = node->getVerkaufspreis();
+        records.push_back(record);
+
+        node = node->right;
+    }
+
+    TreeFileHeader header{};
+    std::memcpy(header.magic, treeFileMagic, sizeof(treeFileMagic));
+    header.recordSize = sizeof(WareRecord);
+    header.nodeCount = count;
+
+    std::ofstream out(path, std::ios::binary | std::ios::trunc);
+    out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    out.write(reinterpret_cast<const char*>(records.data()), (std::streamsize)(records.size() * sizeof(WareRecord)));
+    out.write(reinterpret_cast<const char*>(structure.data()), (std::streamsize)structure.size());
+    if(!out) {
+        throw ErrorTreeFile("Could not write " + path);
+    }
+}
+
+/*  One linear pass over the file: the structure bits are consumed in preorder, the records in in-order.
+    This is the recursive build(){ left = build(); node = next record; right = build(); } with an explicit
+    stack, so a degenerated tree does not overflow the call stack.
+ */
+BinaryTree loadTree(const std::string& path) {
+    MappedFile file(path);
+    const WareRecord* records;
+    const unsigned char* structure;
+    uint64_t count = readTreeFile(file, records, structure);
+
+    BinaryTree tree;
+    if(count == 0) {
+        return tree;
+    }
+
+    struct Frame {
+        unsigned char bits;
+        int stage;          //  0: nothing built yet, 1: left subtree built, 2: right subtree built
+        Ware* node;
+    };
+    uint64_t nextBits = 0;
+    uint64_t nextRecord = 0;
+    //  the bits come from the file: every node has its own 2 bits and record, a file whose bits describe more or
+    //  fewer nodes than nodeCount is rejected before anything outside the mapping is read
+    std::vector<Ware*> built;
+    auto fail = [&built]() {
+        for(Ware* node : built) {
+            delete node;
+        }
+        throw ErrorTreeFile("Tree file structure does not match its node count");
+    };
+    auto readBits = [&]() {
+        if(nextBits >= count) {
+            fail();
+        }
+        unsigned char bits = (structure[nextBits / 4] >> (2 * (nextBits % 4))) & 3;
+        nextBits++;
+        return bits;
+    };
+
+    std::vector<Frame> stack;
+    stack.push_back({readBits(), 0, nullptr});
+    Ware* result = nullptr;     //  root of the subtree finished last
+    while(!stack.empty()) {
+        Frame& frame = stack.back();
+        if(frame.stage == 0) {
+            frame.stage = 1;
+            if(frame.bits & 1) {
+                stack.push_back({readBits(), 0, nullptr});
+                continue;
+            }
+            result = nullptr;
+        }
+        if(frame.stage == 1) {
+            if(nextRecord >= count) {
+                fail();
+            }
+            const WareRecord& record = records[nextRecord++];
+            frame.node = new Ware(record.bezeichnung, record.seriennummer, record.gewicht, record.einkaufspreis,
+                                  record.verkaufspreis);
+            built.push_back(frame.node);
+            frame.node->left = result;
+            frame.stage = 2;
+            if(frame.bits & 2) {
+                stack.push_back({readBits(), 0, nullptr});
+                continue;
+            }
+            result = nullptr;
+        }
+        frame.node->right = result;
+        result = frame.node;
+        stack.pop_back();
+    }
+    if(nextRecord != count) {
+        fail();
+    }
+    tree.rootNode = result;
+    return tree;
+}
+
+MappedWareIndex::MappedWareIndex(const std::string& path) : file(path) {
+    const unsigned char* structure;
+    this->count = readTreeFile(this->file, this->records, structure);
+}
+
+size_t MappedWareIndex::size() const {
+    return this->count;
+}
+
+const WareRecord& MappedWareIndex::operator[](size_t index) const {
+    return this->records[index];
+}
+
+const WareRecord* MappedWareIndex::search(double verkaufspreis) const {
+    const WareRecord* end = this->records + this->count;
+    const WareRecord* found = std::lower_bound(this->records, end, verkaufspreis,
+            [](const WareRecord& record, double price) { return record.verkaufspreis < price; });
+    if(found == end || found->verkaufspreis != verkaufspreis) {
+        return nullptr;
+    }
+    return found;
+}
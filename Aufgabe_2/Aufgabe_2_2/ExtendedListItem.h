@@ -7,13 +7,28 @@
 
 #include <string>
 
+class ListItemSlab;
+
+// items and their towers live in the blocks of a ListItemSlab: only the slab creates items and changes towers
 class ExtendedListItem {
 public:
-    explicit ExtendedListItem(int key);
+    ExtendedListItem(const ExtendedListItem&) = delete;
+    ExtendedListItem& operator=(const ExtendedListItem&) = delete;
     [[nodiscard]] std::string toString() const;
     ExtendedListItem* next;
     ExtendedListItem* previous;
     int key;
+
+    // skip-list tower of an indexed DoublyLinkedList: tower[i] is the next item on level i + 1 (level 0 is next),
+    // height 1 means no tower at all
+    ExtendedListItem** tower;
+    int height;
+
+private:
+    friend class ListItemSlab;
+
+    explicit ExtendedListItem(int key);
+    ~ExtendedListItem() = default;
 };
 
 #endif //AUFGABE_2_2_EXTENDEDLISTITEM_H
@@ -0,0 +1,273 @@
+#include "compactList.h"
+#include <algorithm>
+#include <iostream>
+
+CompactListStore::CompactListStore() {
+    this->freeList = nil;
+    this->count = 0;
+}
+
+uint32_t CompactListStore::allocateSlot(int key) {
+    uint32_t slot;
+    if(this->freeList != nil) {
+        slot = this->freeList;
+        this->freeList = this->next[slot];
+        this->keys[slot] = key;
+    } else {
+        slot = (uint32_t)this->keys.size();
+        this->keys.push_back(key);
+        this->next.push_back(nil);
+        this->previous.push_back(nil);
+    }
+    this->next[slot] = nil;
+    this->previous[slot] = nil;
+    this->count++;
+    return slot;
+}
+
+void CompactListStore::releaseSlot(uint32_t slot) {
+    this->next[slot] = this->freeList;
+    this->freeList = slot;
+    this->count--;
+}
+
+void CompactListStore::releaseChain(uint32_t first, uint32_t last, size_t length) {
+    if(first == nil) {
+        return;
+    }
+    this->next[last] = this->freeList;
+    this->freeList = first;
+    this->count -= length;
+}
+
+void CompactListStore::compact() {
+    std::vector<int32_t> newKeys;
+    std::vector<uint32_t> newNext;
+    std::vector<uint32_t> newPrevious;
+    newKeys.reserve(this->count);
+    newNext.reserve(this->count);
+    newPrevious.reserve(this->count);
+
+    for(CompactList* list : this->lists) {
+        if(list->head == nil) {
+            continue;
+        }
+        auto first = (uint32_t)newKeys.size();
+        for(uint32_t slot = list->head; slot != nil; slot = this->next[slot]) {
+            auto position = (uint32_t)newKeys.size();
+            newKeys.push_back(this->keys[slot]);
+            newNext.push_back(position + 1);
+            newPrevious.push_back(position == first ? nil : position - 1);
+        }
+        newNext.back() = nil;
+        list->head = first;
+        list->tail = (uint32_t)newKeys.size() - 1;
+    }
+    this->keys.swap(newKeys);
+    this->next.swap(newNext);
+    this->previous.swap(newPrevious);
+    this->freeList = nil;
+}
+
+void CompactListStore::reserve(size_t count) {
+    this->keys.reserve(count);
+    this->next.reserve(count);
+    this->previous.reserve(count);
+}
+
+size_t CompactListStore::size() const {
+    return this->count;
+}
+
+size_t CompactListStore::memoryUsage() const {
+    return this->keys.capacity() * sizeof(int32_t) + (this->next.capacity() + this->previous.capacity()) * sizeof(uint32_t);
+}
+
+CompactList::CompactList(CompactListStore& store) : store(store) {
+    this->head = CompactListStore::nil;
+    this->tail = CompactListStore::nil;
+    this->length = 0;
+    this->store.lists.push_back(this);
+}
+
+CompactList::~CompactList() {
+    this->clear();
+    auto& lists = this->store.lists;
+    lists.erase(std::find(lists.begin(), lists.end(), this));
+}
+
+void CompactList::clear() {
+    this->store.releaseChain(this->head, this->tail, this->length);
+    this->head = CompactListStore::nil;
+    this->tail = CompactListStore::nil;
+    this->length = 0;
+}
+
+size_t CompactList::size() const {
+    return this->length;
+}
+
+void CompactList::linkAfter(uint32_t slot, uint32_t after) {
+    CompactListStore& s = this->store;
+    uint32_t before = after == CompactListStore::nil ? this->head : s.next[after];
+    s.previous[slot] = after;
+    s.next[slot] = before;
+    if(after == CompactListStore::nil) {
+        this->head = slot;
+    } else {
+        s.next[after] = slot;
+    }
+    if(before == CompactListStore::nil) {
+        this->tail = slot;
+    } else {
+        s.previous[before] = slot;
+    }
+    this->length++;
+}
+
+void CompactList::insertAtStart(int key) {
+    this->linkAfter(this->store.allocateSlot(key), CompactListStore::nil);
+}
+
+void CompactList::insertAtEnd(int key) {
+    this->linkAfter(this->store.allocateSlot(key), this->tail);
+}
+
+void CompactList::insertSorted(int key) {
+    CompactListStore& s = this->store;
+
+    // list is empty OR new is smaller than head key => insert at front
+    if(this->head == CompactListStore::nil || key < s.keys[this->head]) {
+        this->insertAtStart(key);
+        return;
+    }
+    // new key is not smaller than the tail key => insert at end
+    if(key >= s.keys[this->tail]) {
+        this->insertAtEnd(key);
+        return;
+    }
+    // behind the last key that is not larger
+    uint32_t prev = this->head;
+    while(s.keys[s.next[prev]] <= key) {
+        prev = s.next[prev];
+    }
+    this->linkAfter(s.allocateSlot(key), prev);
+}
+
+void CompactList::deleteItem(int key) {
+    CompactListStore& s = this->store;
+    for(uint32_t slot = this->head; slot != CompactListStore::nil; slot = s.next[slot]) {
+        if(s.keys[slot] == key) {
+            if(s.previous[slot] == CompactListStore::nil) {
+                this->head = s.next[slot];
+            } else {
+                s.next[s.previous[slot]] = s.next[slot];
+            }
+            if(s.next[slot] == CompactListStore::nil) {
+                this->tail = s.previous[slot];
+            } else {
+                s.previous[s.next[slot]] = s.previous[slot];
+            }
+            s.releaseSlot(slot);
+            this->length--;
+            return;
+        }
+    }
+    std::cout << "Item not found!" << std::endl;
+}
+
+bool CompactList::contains(int key) const {
+    for(uint32_t slot = this->head; slot != CompactListStore::nil; slot = this->store.next[slot]) {
+        if(this->store.keys[slot] == key) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void CompactList::append(CompactList* appendingList) {
+    this->spliceAfter(appendingList, this->tail);
+}
+
+void CompactList::splice(CompactList* insertingList, int position) {
+    // find the slot the keys go behind, nil = in front of head
+    uint32_t prev;
+    if(position <= 0) {
+        prev = CompactListStore::nil;
+    } else if((size_t)position >= this->length) {
+        prev = this->tail;
+    } else {
+        prev = this->head;
+        for(int i = 1; i < position; i++) {
+            prev = this->store.next[prev];
+        }
+    }
+    this->spliceAfter(insertingList, prev);
+}
+
+void CompactList::spliceAfter(CompactList* insertingList, uint32_t prev) {
+    if(insertingList == this || insertingList->head == CompactListStore::nil) {
+        return;
+    }
+    uint32_t first;
+    uint32_t last;
+    size_t insertedLength;
+    if(&insertingList->store == &this->store) {
+        first = insertingList->head;
+        last = insertingList->tail;
+        insertedLength = insertingList->length;
+    } else {
+        // keys of another store are copied into a chain of this one, the other store gets its slots back
+        first = CompactListStore::nil;
+        last = CompactListStore::nil;
+        insertingList->forEach([this, &first, &last](int key) {
+            uint32_t slot = this->store.allocateSlot(key);
+            if(last == CompactListStore::nil) {
+                first = slot;
+            } else {
+                this->store.next[last] = slot;
+                this->store.previous[slot] = last;
+            }
+            last = slot;
+        });
+        insertedLength = insertingList->length;
+        insertingList->clear();
+    }
+
+    // clear the inserting list
+    insertingList->head = CompactListStore::nil;
+    insertingList->tail = CompactListStore::nil;
+    insertingList->length = 0;
+
+    CompactListStore& s = this->store;
+    uint32_t after = prev == CompactListStore::nil ? this->head : s.next[prev];
+
+    // set the links correctly
+    s.previous[first] = prev;
+    if(prev == CompactListStore::nil) {
+        this->head = first;
+    } else {
+        s.next[prev] = first;
+    }
+    s.next[last] = after;
+    if(after == CompactListStore::nil) {
+        this->tail = last;
+    } else {
+        s.previous[after] = last;
+    }
+    this->length += insertedLength;
+}
+
+void CompactList::print() const {
+    if(this->head == CompactListStore::nil) {
+        std::cout << "<Empty List>" << std::endl << std::endl;
+        return;
+    }
+    for(uint32_t slot = this->head; slot != CompactListStore::nil; slot = this->store.next[slot]) {
+        std::cout << "Slot: " << slot << "    Objekt: " << this->store.keys[slot];
+        if(this->store.next[slot] != CompactListStore::nil) {
+            std::cout << " -> " << std::endl;
+        }
+    }
+    std::cout << std::endl << std::endl;
+}
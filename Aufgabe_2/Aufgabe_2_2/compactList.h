@@ -0,0 +1,89 @@
+#ifndef AUFGABE_2_2_COMPACTLIST_H
+#define AUFGABE_2_2_COMPACTLIST_H
+
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+
+class CompactList;
+
+/*  --
+    Backing store for CompactLists with 12 bytes per key (ExtendedListItem: 40 bytes plus the malloc header):
+        - key, next and previous of slot i are keys[i], next[i] and previous[i], links are 32-bit slot indices,
+        - deleted slots are chained into a free list (through next) and reused by the next insert,
+          a whole list goes onto the free list in O(1) because its slots are already chained,
+        - several lists can share one store, then append and splice between them only relink, O(1).
+    compact() moves the keys of every list of the store into consecutive slots in list order and drops the free
+    slots, so the next scans walk the vectors front to back.
+--  */
+class CompactListStore {
+    public:
+        CompactListStore();
+        CompactListStore(const CompactListStore&) = delete;
+        CompactListStore& operator=(const CompactListStore&) = delete;
+
+        void compact();
+        void reserve(size_t count);
+        size_t size() const;            //  keys in all lists
+        size_t memoryUsage() const;     //  bytes held by the three vectors
+
+    private:
+        friend class CompactList;
+
+        static constexpr uint32_t nil = 0xFFFFFFFFu;
+
+        std::vector<int32_t> keys;
+        std::vector<uint32_t> next;
+        std::vector<uint32_t> previous;
+        uint32_t freeList;
+        size_t count;
+        std::vector<CompactList*> lists;
+
+        uint32_t allocateSlot(int key);
+        void releaseSlot(uint32_t slot);
+        void releaseChain(uint32_t first, uint32_t last, size_t length);
+};
+
+/*  --
+    DoublyLinkedList on a CompactListStore, same operations and the same behaviour for duplicates and
+    "Item not found!". append and splice take over lists of another store by copying their keys.
+--  */
+class CompactList {
+    public:
+        explicit CompactList(CompactListStore& store);
+        CompactList(const CompactList&) = delete;
+        CompactList& operator=(const CompactList&) = delete;
+        ~CompactList();     //  the slots go back to the store
+
+        void insertSorted(int key);
+        void append(CompactList* appendingList);
+        void splice(CompactList* insertingList, int position);     //  keys end up in front of the key at position
+        void insertAtStart(int key);
+        void insertAtEnd(int key);
+        void deleteItem(int key);
+        bool contains(int key) const;
+        void print() const;
+        void clear();
+        size_t size() const;
+
+        // calls visit(key) for every key from head to tail
+        template<typename Visit>
+        void forEach(Visit visit) const {
+            for(uint32_t slot = this->head; slot != CompactListStore::nil; slot = this->store.next[slot]) {
+                visit(this->store.keys[slot]);
+            }
+        }
+
+    private:
+        friend class CompactListStore;
+
+        CompactListStore& store;
+        uint32_t head;
+        uint32_t tail;
+        size_t length;
+
+        void linkAfter(uint32_t slot, uint32_t after);     //  after nil: new head
+        void spliceAfter(CompactList* insertingList, uint32_t prev);
+};
+
+#endif //AUFGABE_2_2_COMPACTLIST_H
@@ -0,0 +1,189 @@
+#include "concurrentList.h"
+#include <algorithm>
+#include <mutex>
+#include <stdexcept>
+#include <vector>
+
+//  every thread gets two hazard pointers: removeAtStart needs head and head->next, insertAtEnd only tail
+static const int hazardsPerThread = 2;
+
+static std::atomic<bool> slotTaken[ConcurrentList::maxThreads];
+static std::atomic<ConcurrentList::Item*> hazards[ConcurrentList::maxThreads][hazardsPerThread];
+
+//  items a thread could not delete when it ended, the next scan of any thread takes them over
+static std::mutex orphanMutex;
+static std::vector<ConcurrentList::Item*> orphans;
+
+static void scan(std::vector<ConcurrentList::Item*>& retired) {
+    {
+        std::lock_guard<std::mutex> lock(orphanMutex);
+        retired.insert(retired.end(), orphans.begin(), orphans.end());
+        orphans.clear();
+    }
+    std::vector<ConcurrentList::Item*> protectedItems;
+    for(auto & slot : hazards) {
+        for(auto & hazard : slot) {
+            ConcurrentList::Item* item = hazard.load();
+            if(item != nullptr) {
+                protectedItems.push_back(item);
+            }
+        }
+    }
+    std::sort(protectedItems.begin(), protectedItems.end());
+
+    size_t kept = 0;
+    for(ConcurrentList::Item* item : retired) {
+        if(std::binary_search(protectedItems.begin(), protectedItems.end(), item)) {
+            retired[kept++] = item;
+        } else {
+            delete item;
+        }
+    }
+    retired.resize(kept);
+}
+
+//  the hazard pointer slot and the retired items of one thread, the slot is given back when the thread ends
+struct HazardThread {
+    int slot;
+    std::vector<ConcurrentList::Item*> retired;
+
+    HazardThread() {
+        for(this->slot = 0; this->slot < ConcurrentList::maxThreads; this->slot++) {
+            if(!slotTaken[this->slot].exchange(true)) {
+                return;
+            }
+        }
+        throw std::runtime_error("ConcurrentList: more than maxThreads threads");
+    }
+
+    ~HazardThread() {
+        scan(this->retired);
+        if(!this->retired.empty()) {
+            std::lock_guard<std::mutex> lock(orphanMutex);
+            orphans.insert(orphans.end(), this->retired.begin(), this->retired.end());
+        }
+        slotTaken[this->slot] = false;
+    }
+
+    std::atomic<ConcurrentList::Item*>& hazard(int index) {
+        return hazards[this->slot][index];
+    }
+
+    void retire(ConcurrentList::Item* item) {
+        this->retired.push_back(item);
+        if((int)this->retired.size() >= ConcurrentList::retireThreshold) {
+            scan(this->retired);
+        }
+    }
+};
+
+static HazardThread& currentThread() {
+    thread_local HazardThread thread;
+    return thread;
+}
+
+ConcurrentList::Item::Item(int key) : next(nullptr), key(key) {
+}
+
+ConcurrentList::ConcurrentList() {
+    auto* dummy = new Item(0);
+    this->head = dummy;
+    this->tail = dummy;
+}
+
+ConcurrentList::~ConcurrentList() {
+    Item* current = this->head.load();
+    while(current != nullptr) {
+        Item* next = current->next.load();
+        delete current;
+        current = next;
+    }
+}
+
+void ConcurrentList::insertAtEnd(int key) {
+    auto* newItem = new Item(key);
+    HazardThread& thread = currentThread();
+    std::atomic<Item*>& hazard = thread.hazard(0);
+
+    while(true) {
+        Item* last = this->tail.load();
+        hazard.store(last);
+        // announced too late if tail moved on in the meantime: last may already be deleted
+        if(last != this->tail.load()) {
+            continue;
+        }
+        Item* next = last->next.load();
+        if(next != nullptr) {
+            // another thread linked its item but did not move tail yet, help it
+            this->tail.compare_exchange_weak(last, next);
+            continue;
+        }
+        Item* expected = nullptr;
+        if(last->next.compare_exchange_weak(expected, newItem)) {
+            this->tail.compare_exchange_strong(last, newItem);
+            break;
+        }
+    }
+    hazard.store(nullptr);
+}
+
+bool ConcurrentList::removeAtStart(int& key) {
+    HazardThread& thread = currentThread();
+    std::atomic<Item*>& headHazard = thread.hazard(0);
+    std::atomic<Item*>& nextHazard = thread.hazard(1);
+
+    Item* first;
+    while(true) {
+        first = this->head.load();
+        headHazard.store(first);
+        if(first != this->head.load()) {
+            continue;
+        }
+        Item* last = this->tail.load();
+        Item* next = first->next.load();
+        nextHazard.store(next);
+        if(first != this->head.load()) {
+            continue;
+        }
+        if(next == nullptr) {
+            headHazard.store(nullptr);
+            nextHazard.store(nullptr);
+            return false;
+        }
+        if(first == last) {
+            // tail lags behind, move it before head passes it
+            this->tail.compare_exchange_weak(last, next);
+            continue;
+        }
+        key = next->key;
+        if(this->head.compare_exchange_weak(first, next)) {
+            break;
+        }
+    }
+    headHazard.store(nullptr);
+    nextHazard.store(nullptr);
+    // next is the new dummy, the old one is deleted once no thread looks at it anymore
+    thread.retire(first);
+    return true;
+}
+
+bool ConcurrentList::isEmpty() const {
+    // with other threads inserting or removing at the same time the answer is only a snapshot
+    HazardThread& thread = currentThread();
+    std::atomic<Item*>& hazard = thread.hazard(0);
+    Item* first;
+    do {
+        first = this->head.load();
+        hazard.store(first);
+    } while(first != this->head.load());
+    bool empty = first->next.load() == nullptr;
+    hazard.store(nullptr);
+    return empty;
+}
+
+void ConcurrentList::drainInto(DoublyLinkedList& list) {
+    int key;
+    while(this->removeAtStart(key)) {
+        list.insertAtEnd(key);
+    }
+}
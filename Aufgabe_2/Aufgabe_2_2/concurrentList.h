@@ -0,0 +1,44 @@
+#ifndef AUFGABE_2_2_CONCURRENTLIST_H
+#define AUFGABE_2_2_CONCURRENTLIST_H
+
+#include "doublyLinkedList.h"
+#include <atomic>
+
+/*  --
+    Lock-free list for producer/consumer pipelines: insertAtEnd and removeAtStart can be called from any number of
+    threads at once (Michael-Scott queue). The list always starts with a dummy item, head is the dummy and the first
+    key sits in head->next; removing moves head one item forward and the old dummy is freed.
+    A thread that follows head or tail announces the item in one of its hazard pointers first, removed items are
+    only deleted once no hazard pointer of any thread points to them (the check runs every retireThreshold items).
+    At most maxThreads threads may use ConcurrentLists at the same time.
+    The single-threaded DoublyLinkedList stays as it is; drainInto() moves everything that is in the queue into one.
+--  */
+class ConcurrentList {
+    public:
+        static const int maxThreads = 128;
+        static const int retireThreshold = 2 * 2 * maxThreads;
+
+        ConcurrentList();
+        ConcurrentList(const ConcurrentList&) = delete;
+        ConcurrentList& operator=(const ConcurrentList&) = delete;
+        ~ConcurrentList();      // no other thread may use the list anymore
+
+        void insertAtEnd(int key);
+        bool removeAtStart(int& key);   // false if the list was empty
+        bool isEmpty() const;
+        void drainInto(DoublyLinkedList& list);
+
+        struct Item {
+            std::atomic<Item*> next;
+            int key;
+
+            explicit Item(int key);
+        };
+
+    private:
+        //  head and tail are written by different threads, so they get a cache line each
+        alignas(64) std::atomic<Item*> head;
+        alignas(64) std::atomic<Item*> tail;
+};
+
+#endif //AUFGABE_2_2_CONCURRENTLIST_H
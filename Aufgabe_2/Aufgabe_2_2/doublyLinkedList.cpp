@@ -5,14 +5,69 @@
 
 #include <iomanip>
 #include "doublyLinkedList.h"
+#include <algorithm>
+#include <cstdint>
+#include <future>
+#include <thread>
 
-DoublyLinkedList::DoublyLinkedList() {
+DoublyLinkedList::DoublyLinkedList() : DoublyLinkedList(std::make_shared<ListItemSlab>()) {
+}
+
+DoublyLinkedList::DoublyLinkedList(std::shared_ptr<ListItemSlab> slab) : generator(20220604), slab(std::move(slab)) {
+    this->towers = false;
     this->head = nullptr;
     this->tail = nullptr;
+    this->length = 0;
+    this->indexed = false;
+    this->levels = 1;
+    for(auto & first : this->headTower) {
+        first = nullptr;
+    }
+}
+
+DoublyLinkedList::~DoublyLinkedList() {
+    this->clear();
+}
+
+void DoublyLinkedList::clear() {
+    ListItemSlab::resolve(this->slab);
+    if(this->towers) {
+        for(ExtendedListItem* current = this->head; current != nullptr; current = current->next) {
+            this->slab->setHeight(current, 1);
+        }
+        this->towers = false;
+    }
+    this->slab->release(this->head, this->tail);
+    this->head = nullptr;
+    this->tail = nullptr;
+    this->length = 0;
+    this->dropIndex();
+}
+
+size_t DoublyLinkedList::size() const {
+    return this->length;
+}
+
+std::shared_ptr<ListItemSlab> DoublyLinkedList::getSlab() {
+    ListItemSlab::resolve(this->slab);
+    return this->slab;
+}
+
+ExtendedListItem* DoublyLinkedList::createItem(int key, int height) {
+    ListItemSlab::resolve(this->slab);
+    return this->slab->create(key, height);
+}
+
+void DoublyLinkedList::destroyItem(ExtendedListItem* item) {
+    ListItemSlab::resolve(this->slab);
+    this->slab->destroy(item);
 }
 
 void DoublyLinkedList::insertAtStart(int key) {
-    auto* temp = new ExtendedListItem(key);
+    if(this->indexed) {
+        this->dropIndex();
+    }
+    auto* temp = this->createItem(key);
 
     // set the pointers correctly
     if(this->head == nullptr) {
@@ -28,10 +83,14 @@ void DoublyLinkedList::insertAtStart(int key) {
         temp->previous = nullptr;
         this->head = temp;
     }
+    this->length++;
 }
 
 void DoublyLinkedList::insertAtEnd(int key) {
-    auto* temp = new ExtendedListItem(key);
+    if(this->indexed) {
+        this->dropIndex();
+    }
+    auto* temp = this->createItem(key);
 
     // set the pointers correctly
     if(this->head == nullptr) {
@@ -47,26 +106,32 @@ void DoublyLinkedList::insertAtEnd(int key) {
         this->tail->next = temp;
         this->tail = temp;
     }
+    this->length++;
 }
 
 void DoublyLinkedList::insertSorted(int key) {
+    if(this->indexed) {
+        this->insertIndexed(key);
+        return;
+    }
     ExtendedListItem* prev = nullptr;
     ExtendedListItem* current = this->head;
 
-    //create the new extendedListItem
-    auto* newItem = new ExtendedListItem(key);
-
     // list is empty OR new is smaller than head->key => insert at front
     if(this->head == nullptr || key < this->head->key) {
         this->insertAtStart(key);
         return;
     }
 
-    // new key is larger than tail->key=> insert at end
-    if(key > this->tail->key) {
+    // new key is not smaller than tail->key => insert at end (the search below would run past the tail)
+    if(key >= this->tail->key) {
         this->insertAtEnd(key);
         return;
     }
+    //create the new extendedListItem, only now that none of the shortcuts above took the key
+    auto* newItem = this->createItem(key);
+    this->length++;
+
     // search for correct position to insert
     bool inserted = false;
     while(!inserted) {
@@ -110,22 +175,35 @@ void DoublyLinkedList::print() const {
 
 void DoublyLinkedList::append(DoublyLinkedList* appendingList) {
     if(appendingList->head != nullptr && appendingList->tail != nullptr) {
+        this->dropIndex();
+        appendingList->dropIndex();
+        ListItemSlab::merge(this->slab, appendingList->slab);
+        this->towers |= appendingList->towers;
 
         // set the pointers correctly
-        this->tail->next = appendingList->head;
-        appendingList->head->previous = this->tail;
+        if(this->tail == nullptr) {
+            this->head = appendingList->head;
+        } else {
+            this->tail->next = appendingList->head;
+            appendingList->head->previous = this->tail;
+        }
         this->tail = appendingList->tail;
-
-
+        this->length += appendingList->length;
 
         // clear the inserting list
         appendingList->head = nullptr;
         appendingList->tail = nullptr;
+        appendingList->length = 0;
     }
 }
 
-void DoublyLinkedList::splice(DoublyLinkedList* insertingList, int position) const {
+void DoublyLinkedList::splice(DoublyLinkedList* insertingList, int position) {
     if((insertingList->head != nullptr) & (insertingList->tail != nullptr)) {
+        this->dropIndex();
+        insertingList->dropIndex();
+        ListItemSlab::merge(this->slab, insertingList->slab);
+        this->towers |= insertingList->towers;
+
         ExtendedListItem* prev = nullptr;
         ExtendedListItem* current = this->head;
 
@@ -139,22 +217,27 @@ void DoublyLinkedList::splice(DoublyLinkedList* insertingList, int position) con
         insertingList->head->previous = prev;
         insertingList->tail->next = current;
         current->previous = insertingList->tail;
+        this->length += insertingList->length;
 
         // clear the inserting list
         insertingList->head = nullptr;
         insertingList->tail = nullptr;
+        insertingList->length = 0;
     }
 }
 
 void DoublyLinkedList::deleteItem(int key) {
+    if(this->indexed) {
+        this->deleteIndexed(key);
+        return;
+    }
     ExtendedListItem* current = this->head;
 
     while(current != nullptr) {
         if(key == current->key) {
 
-            // If item is start of list
+            // If item is start of list (a single item is start and end at once)
             if(current->previous == nullptr) {
-                current->next->previous = nullptr;
                 this->head = current->next;
             } else {
                 current->previous->next = current->next;
@@ -162,13 +245,13 @@ void DoublyLinkedList::deleteItem(int key) {
 
             // If item is end of list
             if(current->next == nullptr) {
-                current->previous->next = nullptr;
                 this->tail = current->previous;
             } else {
                 current->next->previous = current->previous;
             }
 
-            delete current;
+            this->destroyItem(current);
+            this->length--;
 
             //Return in void... needed here otherwise it will print out "Item not found"
             return;
@@ -178,4 +261,352 @@ void DoublyLinkedList::deleteItem(int key) {
     std::cout << "Item not found!" << std::endl;
 }
 
+ExtendedListItem* DoublyLinkedList::search(int key) const {
+    if(!this->indexed) {
+        // without index the list may be unsorted, so every item has to be checked
+        for(ExtendedListItem* current = this->head; current != nullptr; current = current->next) {
+            if(current->key == key) {
+                return current;
+            }
+        }
+        return nullptr;
+    }
+    const ExtendedListItem* current = nullptr;
+    for(int level = this->levels - 1; level >= 0; level--) {
+        ExtendedListItem* nextItem;
+        while((nextItem = this->forward(current, level)) != nullptr && nextItem->key < key) {
+            current = nextItem;
+        }
+    }
+    ExtendedListItem* found = this->forward(current, 0);
+    return found != nullptr && found->key == key ? found : nullptr;
+}
+
+// new towers for all items, linked level by level in one pass
+bool DoublyLinkedList::buildIndex() {
+    for(ExtendedListItem* current = this->head; current != nullptr && current->next != nullptr; current = current->next) {
+        if(current->next->key < current->key) {
+            this->dropIndex();
+            return false;
+        }
+    }
+    ExtendedListItem* last[maxLevel] = {};
+    ListItemSlab::resolve(this->slab);
+    this->towers = true;
+    this->levels = 1;
+    for(auto & first : this->headTower) {
+        first = nullptr;
+    }
+    for(ExtendedListItem* current = this->head; current != nullptr; current = current->next) {
+        this->slab->setHeight(current, this->randomHeight());
+        for(int level = 1; level < current->height; level++) {
+            this->forward(last[level], level) = current;
+            last[level] = current;
+        }
+        if(current->height > this->levels) {
+            this->levels = current->height;
+        }
+    }
+    this->indexed = true;
+    return true;
+}
+
+// the towers stay allocated until the items are deleted or the index is built again
+void DoublyLinkedList::dropIndex() {
+    this->indexed = false;
+    this->levels = 1;
+    for(auto & first : this->headTower) {
+        first = nullptr;
+    }
+}
+
+bool DoublyLinkedList::isIndexed() const {
+    return this->indexed;
+}
+
+int DoublyLinkedList::randomHeight() {
+    int height = 1;
+    while(height < maxLevel && (this->generator() & 3) == 0) {
+        height++;
+    }
+    return height;
+}
+
+// link to the next item on level; item nullptr stands for the start of the list
+ExtendedListItem*& DoublyLinkedList::forward(ExtendedListItem* item, int level) {
+    if(item == nullptr) {
+        return level == 0 ? this->head : this->headTower[level];
+    }
+    return level == 0 ? item->next : item->tower[level - 1];
+}
+
+ExtendedListItem* DoublyLinkedList::forward(const ExtendedListItem* item, int level) const {
+    if(item == nullptr) {
+        return level == 0 ? this->head : this->headTower[level];
+    }
+    return level == 0 ? item->next : item->tower[level - 1];
+}
+
+// predecessors[level] = last item on level with a smaller key (or an equal one, if includeEqual), nullptr = start
+void DoublyLinkedList::findPredecessors(int key, bool includeEqual, ExtendedListItem* predecessors[]) {
+    ExtendedListItem* current = nullptr;
+    for(int level = this->levels - 1; level >= 0; level--) {
+        ExtendedListItem* nextItem;
+        while((nextItem = this->forward(current, level)) != nullptr &&
+              (nextItem->key < key || (includeEqual && nextItem->key == key))) {
+            current = nextItem;
+        }
+        predecessors[level] = current;
+    }
+}
+
+// like insertSorted, the new item goes behind all items with the same key
+void DoublyLinkedList::insertIndexed(int key) {
+    ExtendedListItem* predecessors[maxLevel];
+    this->findPredecessors(key, true, predecessors);
+
+    int height = this->randomHeight();
+    for(int level = this->levels; level < height; level++) {
+        predecessors[level] = nullptr;
+    }
+    if(height > this->levels) {
+        this->levels = height;
+    }
+
+    auto* newItem = this->createItem(key, height);
+    this->length++;
+    this->towers = true;
+    for(int level = 0; level < height; level++) {
+        this->forward(newItem, level) = this->forward(predecessors[level], level);
+        this->forward(predecessors[level], level) = newItem;
+    }
+    newItem->previous = predecessors[0];
+    if(newItem->next != nullptr) {
+        newItem->next->previous = newItem;
+    } else {
+        this->tail = newItem;
+    }
+}
+
+void DoublyLinkedList::deleteIndexed(int key) {
+    ExtendedListItem* predecessors[maxLevel];
+    this->findPredecessors(key, false, predecessors);
+
+    ExtendedListItem* current = this->forward(predecessors[0], 0);
+    if(current == nullptr || current->key != key) {
+        std::cout << "Item not found!" << std::endl;
+        return;
+    }
+    // current is the first item with key, so on every level of its tower it follows the predecessor directly
+    for(int level = 0; level < current->height; level++) {
+        this->forward(predecessors[level], level) = this->forward(current, level);
+    }
+    if(current->next != nullptr) {
+        current->next->previous = current->previous;
+    } else {
+        this->tail = current->previous;
+    }
+    this->destroyItem(current);
+    this->length--;
+
+    while(this->levels > 1 && this->headTower[this->levels - 1] == nullptr) {
+        this->levels--;
+    }
+}
+
+// stable: of two equal keys the one from left comes first
+DoublyLinkedList::Run DoublyLinkedList::mergeRuns(Run left, Run right) {
+    if(left.head == nullptr) {
+        return right;
+    }
+    if(right.head == nullptr) {
+        return left;
+    }
+    Run merged = {nullptr, nullptr, left.length + right.length};
+    ExtendedListItem* a = left.head;
+    ExtendedListItem* b = right.head;
+    ExtendedListItem* last = nullptr;
+    // both chains end at their tail, the length of the shorter one bounds the loop
+    size_t restA = left.length;
+    size_t restB = right.length;
+    while(restA > 0 && restB > 0) {
+        ExtendedListItem* next;
+        if(b->key < a->key) {
+            next = b;
+            b = b->next;
+            restB--;
+        } else {
+            next = a;
+            a = a->next;
+            restA--;
+        }
+        if(last == nullptr) {
+            merged.head = next;
+        } else {
+            last->next = next;
+        }
+        next->previous = last;
+        last = next;
+    }
+    // the rest of one chain is already linked, it only has to be hooked on
+    ExtendedListItem* rest = restA > 0 ? a : b;
+    last->next = rest;
+    rest->previous = last;
+    merged.tail = restA > 0 ? left.tail : right.tail;
+    return merged;
+}
+
+//  Below this many items the runs are merged on the current thread
+static const size_t parallelMergeCutoff = 1 << 14;
+
+/*  Merges runs [start, end) like a balanced tree: both halves are merged first, then the two results.
+    As long as threadDepth > 0 the left half is merged on a new thread while the current thread merges the right half,
+    the halves hold disjoint items so no synchronization is needed.
+ */
+DoublyLinkedList::Run DoublyLinkedList::mergeRuns(std::vector<Run>& runs, size_t start, size_t end, int threadDepth) {
+    if(end - start == 1) {
+        return runs[start];
+    }
+    size_t middle = start + (end - start) / 2;
+    size_t items = 0;
+    for(size_t i = start; i < end && items <= parallelMergeCutoff; i++) {
+        items += runs[i].length;
+    }
+    Run left;
+    Run right;
+    if(threadDepth > 0 && items > parallelMergeCutoff) {
+        auto leftHalf = std::async(std::launch::async, [&runs, start, middle, threadDepth]() {
+            return mergeRuns(runs, start, middle, threadDepth - 1);
+        });
+        right = mergeRuns(runs, middle, end, threadDepth - 1);
+        left = leftHalf.get();
+    } else {
+        left = mergeRuns(runs, start, middle, 0);
+        right = mergeRuns(runs, middle, end, 0);
+    }
+    return mergeRuns(left, right);
+}
+
+void DoublyLinkedList::mergeSorted(DoublyLinkedList* other) {
+    if(other == this || other->head == nullptr) {
+        return;
+    }
+    bool wasIndexed = this->indexed;
+    this->dropIndex();
+    other->dropIndex();
+    ListItemSlab::merge(this->slab, other->slab);
+    this->towers |= other->towers;
+
+    Run merged = mergeRuns({this->head, this->tail, this->length}, {other->head, other->tail, other->length});
+    this->head = merged.head;
+    this->tail = merged.tail;
+    this->length = merged.length;
+    this->head->previous = nullptr;
+    this->tail->next = nullptr;
+
+    // clear the other list
+    other->head = nullptr;
+    other->tail = nullptr;
+    other->length = 0;
+
+    if(wasIndexed) {
+        this->buildIndex();
+    }
+}
 
+void DoublyLinkedList::sort() {
+    if(this->head == nullptr) {
+        return;
+    }
+    bool wasIndexed = this->indexed;
+    this->dropIndex();
+
+    // split the list into maximal ascending runs, an already sorted list is a single run
+    std::vector<Run> runs;
+    Run run = {this->head, this->head, 1};
+    for(ExtendedListItem* current = this->head->next; current != nullptr; current = current->next) {
+        if(current->key < run.tail->key) {
+            runs.push_back(run);
+            run = {current, current, 1};
+        } else {
+            run.tail = current;
+            run.length++;
+        }
+    }
+    runs.push_back(run);
+
+    //  every level of threads doubles the number of threads: depth = log2(number of cores)
+    int threadDepth = 0;
+    for(unsigned int cores = std::thread::hardware_concurrency(); cores > 1; cores /= 2) {
+        threadDepth++;
+    }
+    Run sorted = mergeRuns(runs, 0, runs.size(), threadDepth);
+    this->head = sorted.head;
+    this->tail = sorted.tail;
+    this->head->previous = nullptr;
+    this->tail->next = nullptr;
+
+    if(wasIndexed) {
+        this->buildIndex();
+    }
+}
+
+//  LSD radix sort, one byte per pass; the sign bit is flipped so that negative keys come first
+static void radixSort(std::vector<int>& keys) {
+    if(keys.size() < 64) {
+        std::sort(keys.begin(), keys.end());
+        return;
+    }
+    std::vector<int> buffer(keys.size());
+    for(int shift = 0; shift < 32; shift += 8) {
+        size_t counts[257] = {};
+        for(int key : keys) {
+            counts[((uint32_t)key ^ 0x80000000u) >> shift & 0xFF]++;
+        }
+        // all keys share this byte, the pass would not change anything
+        if(counts[((uint32_t)keys[0] ^ 0x80000000u) >> shift & 0xFF] == keys.size()) {
+            continue;
+        }
+        size_t offset = 0;
+        for(size_t & count : counts) {
+            size_t current = count;
+            count = offset;
+            offset += current;
+        }
+        for(int key : keys) {
+            buffer[counts[((uint32_t)key ^ 0x80000000u) >> shift & 0xFF]++] = key;
+        }
+        keys.swap(buffer);
+    }
+}
+
+void DoublyLinkedList::insertSortedBatch(const int keys[], int size) {
+    if(size <= 0) {
+        return;
+    }
+    if(this->indexed && (size_t)size * 16 < this->length) {
+        for(int i = 0; i < size; i++) {
+            this->insertIndexed(keys[i]);
+        }
+        return;
+    }
+    bool wasIndexed = this->indexed;
+    this->dropIndex();
+
+    std::vector<int> sorted(keys, keys + size);
+    radixSort(sorted);
+    ListItemSlab::resolve(this->slab);
+    ExtendedListItem* batch = this->slab->createRun(sorted.data(), size);
+
+    // the list comes first, so equal keys from the batch end up behind the ones already in the list
+    Run merged = mergeRuns({this->head, this->tail, this->length}, {batch, batch + size - 1, (size_t)size});
+    this->head = merged.head;
+    this->tail = merged.tail;
+    this->length = merged.length;
+    this->head->previous = nullptr;
+    this->tail->next = nullptr;
+
+    if(wasIndexed) {
+        this->buildIndex();
+    }
+}
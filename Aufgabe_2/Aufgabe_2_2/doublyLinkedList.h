@@ -6,27 +6,89 @@
 #define AUFGABE_2_2_DOUBLYLINKEDLIST_H
 
 #include "ExtendedListItem.h"
+#include "listItemSlab.h"
 #include <iostream>
+#include <random>
+#include <vector>
 
+/*  --
+    Optional skip-list index: after buildIndex() every item gets a tower of random height (1 + geometric with
+    p = 1/4), and insertSorted, deleteItem and search run in expected O(log n) instead of walking from head.
+    Level 0 stays the doubly linked list, so head, tail, next and previous keep working as before.
+    append, splice, insertAtStart and insertAtEnd stay O(1) and may break the order, so they drop the index;
+    buildIndex() puts it back in O(n) as long as the list is sorted.
 
+    Items come from a ListItemSlab instead of new/delete. Every list gets its own slab unless one is passed in;
+    append and splice merge the slabs of both lists, so moved items never point into memory the list does not keep
+    alive. clear() and the destructor hand the whole chain back to the slab in O(1) (O(n) only if towers have to be
+    freed), the blocks themselves go when the last list on the slab is gone.
+
+    insertSortedBatch() radix sorts a copy of the batch, creates all its items in one contiguous piece of the slab
+    and merges them into the list in a single pass, like insertSorted every new key goes behind equal keys.
+    On an indexed list a small batch (k * 16 < n) is inserted key by key through the index instead, O(k log n).
+
+    mergeSorted() and sort() only relink items, nothing is allocated for the items. Both are stable, and an index
+    the list had before is built again afterwards.
+--  */
 struct DoublyLinkedList {
 public:
     DoublyLinkedList();
+    explicit DoublyLinkedList(std::shared_ptr<ListItemSlab> slab);     // share the slab with other lists
+    DoublyLinkedList(const DoublyLinkedList&) = delete;
+    DoublyLinkedList& operator=(const DoublyLinkedList&) = delete;
+    ~DoublyLinkedList();    // returns all items still in the list to the slab
 
     ExtendedListItem* head;
     ExtendedListItem* tail;
     void insertSorted(int key);
+    void insertSortedBatch(const int keys[], int size);     // any order, O(n + k) plus sorting the batch
 
     void append(DoublyLinkedList* appendingList);
-    void splice(DoublyLinkedList* insertingList, int position) const;
+    void splice(DoublyLinkedList* insertingList, int position);
+    void mergeSorted(DoublyLinkedList* other);  // both lists sorted, O(n + m), other is empty afterwards
+    void sort();                                // natural mergesort, runs are merged on several threads
     void insertAtStart(int key);
     void insertAtEnd(int key);
     void deleteItem(int key);
+    ExtendedListItem* search(int key) const;   // first item with key, nullptr if there is none
     void print() const;
+    void clear();
+    [[nodiscard]] size_t size() const;
+    std::shared_ptr<ListItemSlab> getSlab();
+
+    bool buildIndex();      // false (and no index) if the list is not sorted
+    void dropIndex();
+    bool isIndexed() const;
+
+    static const int maxLevel = ListItemSlab::maxHeight;    // 4^16 items before the top level fills up
 
 private:
+    size_t length;                          // items in the list, kept up to date by every operation
+    bool indexed;
+    int levels;                             // levels in use, at least 1
+    ExtendedListItem* headTower[maxLevel];  // first item on every level above 0 (level 0 starts at head)
+    std::minstd_rand generator;
+    std::shared_ptr<ListItemSlab> slab;
+    bool towers;                            // some items may still own a tower
+
+    ExtendedListItem* createItem(int key, int height = 1);
 
+    // sorted chain of items linked in both directions, head->previous and tail->next are not set
+    struct Run {
+        ExtendedListItem* head;
+        ExtendedListItem* tail;
+        size_t length;
+    };
+    static Run mergeRuns(Run left, Run right);
+    static Run mergeRuns(std::vector<Run>& runs, size_t start, size_t end, int threadDepth);
+    void destroyItem(ExtendedListItem* item);
 
+    int randomHeight();
+    ExtendedListItem*& forward(ExtendedListItem* item, int level);
+    ExtendedListItem* forward(const ExtendedListItem* item, int level) const;
+    void findPredecessors(int key, bool includeEqual, ExtendedListItem* predecessors[]);
+    void insertIndexed(int key);
+    void deleteIndexed(int key);
 };
 
 #endif //AUFGABE_2_2_DOUBLYLINKEDLIST_H
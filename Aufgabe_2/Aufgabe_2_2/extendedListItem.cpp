@@ -12,4 +12,6 @@ ExtendedListItem::ExtendedListItem(int key) {
     this->key = key;
     this->next = nullptr;
     this->previous = nullptr;
+    this->tower = nullptr;
+    this->height = 1;
 }
@@ -0,0 +1,181 @@
+#include "listItemSlab.h"
+#include <cstring>
+#include <new>
+
+ListItemSlab::ListItemSlab() {
+    this->usedInLastBlock = blockSize;
+    this->freeItems = nullptr;
+    this->lastFreeItem = nullptr;
+    for(int height = 0; height <= maxHeight; height++) {
+        this->freeTowers[height] = nullptr;
+        this->lastFreeTower[height] = nullptr;
+    }
+}
+
+ListItemSlab::~ListItemSlab() {
+    for(char* block : this->blocks) {
+        ::operator delete(block);
+    }
+}
+
+// a free tower keeps the next free tower of the same height in its first link
+ExtendedListItem** ListItemSlab::getNextTower(ExtendedListItem** tower) {
+    return reinterpret_cast<ExtendedListItem**>(tower[0]);
+}
+
+void ListItemSlab::setNextTower(ExtendedListItem** tower, ExtendedListItem** next) {
+    tower[0] = reinterpret_cast<ExtendedListItem*>(next);
+}
+
+// items and towers only hold pointers and ints, so every chunk is a multiple of the pointer alignment
+void* ListItemSlab::bump(size_t bytes) {
+    if(this->usedInLastBlock + bytes > blockSize) {
+        this->blocks.push_back(static_cast<char*>(::operator new(blockSize)));
+        this->usedInLastBlock = 0;
+    }
+    void* chunk = this->blocks.back() + this->usedInLastBlock;
+    this->usedInLastBlock += bytes;
+    return chunk;
+}
+
+ExtendedListItem* ListItemSlab::create(int key, int height) {
+    ExtendedListItem* item;
+    if(this->freeItems != nullptr) {
+        item = this->freeItems;
+        this->freeItems = item->next;
+        if(this->freeItems == nullptr) {
+            this->lastFreeItem = nullptr;
+        }
+        item->key = key;
+        item->next = nullptr;
+        item->previous = nullptr;
+    } else {
+        item = new(this->bump(sizeof(ExtendedListItem))) ExtendedListItem(key);
+    }
+    this->setHeight(item, height);
+    return item;
+}
+
+ExtendedListItem* ListItemSlab::createRun(const int keys[], int count) {
+    if(count <= 0) {
+        return nullptr;
+    }
+    size_t bytes = count * sizeof(ExtendedListItem);
+    ExtendedListItem* items;
+    if(bytes <= blockSize) {
+        items = static_cast<ExtendedListItem*>(this->bump(bytes));
+    } else {
+        //  a block of its own, in front of the last block so that bump() goes on with the current one
+        char* block = static_cast<char*>(::operator new(bytes));
+        this->blocks.insert(this->blocks.end() - (this->blocks.empty() ? 0 : 1), block);
+        if(this->blocks.size() == 1) {
+            this->usedInLastBlock = blockSize;
+        }
+        items = reinterpret_cast<ExtendedListItem*>(block);
+    }
+    for(int i = 0; i < count; i++) {
+        new(items + i) ExtendedListItem(keys[i]);
+        items[i].previous = i > 0 ? items + i - 1 : nullptr;
+        items[i].next = i + 1 < count ? items + i + 1 : nullptr;
+    }
+    return items;
+}
+
+void ListItemSlab::freeTower(ExtendedListItem** tower, int height) {
+    setNextTower(tower, this->freeTowers[height]);
+    if(this->freeTowers[height] == nullptr) {
+        this->lastFreeTower[height] = tower;
+    }
+    this->freeTowers[height] = tower;
+}
+
+void ListItemSlab::setHeight(ExtendedListItem* item, int height) {
+    if(item->height == height) {
+        if(item->tower != nullptr) {
+            std::memset(item->tower, 0, (height - 1) * sizeof(ExtendedListItem*));
+        }
+        return;
+    }
+    if(item->tower != nullptr) {
+        this->freeTower(item->tower, item->height);
+    }
+    item->tower = nullptr;
+    item->height = height;
+    if(height == 1) {
+        return;
+    }
+
+    ExtendedListItem** tower = this->freeTowers[height];
+    if(tower != nullptr) {
+        this->freeTowers[height] = getNextTower(tower);
+        if(this->freeTowers[height] == nullptr) {
+            this->lastFreeTower[height] = nullptr;
+        }
+    } else {
+        tower = static_cast<ExtendedListItem**>(this->bump((height - 1) * sizeof(ExtendedListItem*)));
+    }
+    std::memset(tower, 0, (height - 1) * sizeof(ExtendedListItem*));
+    item->tower = tower;
+}
+
+void ListItemSlab::destroy(ExtendedListItem* item) {
+    this->setHeight(item, 1);
+    item->next = this->freeItems;
+    if(this->freeItems == nullptr) {
+        this->lastFreeItem = item;
+    }
+    this->freeItems = item;
+}
+
+void ListItemSlab::release(ExtendedListItem* first, ExtendedListItem* last) {
+    if(first == nullptr) {
+        return;
+    }
+    last->next = this->freeItems;
+    if(this->freeItems == nullptr) {
+        this->lastFreeItem = last;
+    }
+    this->freeItems = first;
+}
+
+void ListItemSlab::merge(std::shared_ptr<ListItemSlab>& into, std::shared_ptr<ListItemSlab>& other) {
+    resolve(into);
+    resolve(other);
+    if(into == other) {
+        return;
+    }
+    ListItemSlab& target = *into;
+    ListItemSlab& source = *other;
+
+    //  target keeps cutting chunks out of its own last block, so the source blocks go in front of it
+    //  (the unused rest of the source's last block is lost, less than one block)
+    if(!source.blocks.empty()) {
+        target.blocks.insert(target.blocks.end() - (target.blocks.empty() ? 0 : 1), source.blocks.begin(), source.blocks.end());
+        if(target.blocks.size() == source.blocks.size()) {
+            target.usedInLastBlock = source.usedInLastBlock;
+        }
+        source.blocks.clear();
+    }
+    if(source.freeItems != nullptr) {
+        target.release(source.freeItems, source.lastFreeItem);
+        source.freeItems = nullptr;
+        source.lastFreeItem = nullptr;
+    }
+    for(int height = 2; height <= maxHeight; height++) {
+        if(source.freeTowers[height] != nullptr) {
+            setNextTower(source.lastFreeTower[height], target.freeTowers[height]);
+            if(target.freeTowers[height] == nullptr) {
+                target.lastFreeTower[height] = source.lastFreeTower[height];
+            }
+            target.freeTowers[height] = source.freeTowers[height];
+            source.freeTowers[height] = nullptr;
+            source.lastFreeTower[height] = nullptr;
+        }
+    }
+    source.forward = into;
+    other = into;
+}
+
+size_t ListItemSlab::getBlockCount() const {
+    return this->blocks.size();
+}
@@ -0,0 +1,66 @@
+#ifndef AUFGABE_2_2_LISTITEMSLAB_H
+#define AUFGABE_2_2_LISTITEMSLAB_H
+
+#include "ExtendedListItem.h"
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+/*  --
+    Slab allocator for the items of a DoublyLinkedList and their skip-list towers: both are cut out of blocks of
+    blockSize bytes one after the other, so a new item and its tower usually share a cache line.
+    createRun() cuts a whole batch of items out of one contiguous piece (the current block, or a block of its own).
+    Freed items go onto a free list chained through next, freed towers onto one free list per height (chained
+    through tower[0]); both are handed out again before a block is touched.
+    - release(first, last) puts a whole chain of items without towers onto the free list in O(1).
+    - the blocks are freed all at once when the last list using the slab is gone.
+    - merge() is used when append/splice move items between lists on different slabs: the blocks and the free
+      lists of one slab move into the other and the emptied slab forwards to it, so both lists allocate from (and
+      keep alive) the same memory from then on. resolve() follows the forwarding to the slab in use.
+    Items are never destroyed, only reused, and their tower is only changed by setHeight() of the slab; the
+    constructor and destructor of ExtendedListItem are private, so no item or tower memory is freed elsewhere.
+    Not thread-safe, every thread needs its own lists and slabs.
+--  */
+class ListItemSlab {
+    public:
+        static const size_t blockSize = 64 * 1024;
+        static const int maxHeight = 16;
+
+        ListItemSlab();
+        ListItemSlab(const ListItemSlab&) = delete;
+        ListItemSlab& operator=(const ListItemSlab&) = delete;
+        ~ListItemSlab();
+
+        ExtendedListItem* create(int key, int height = 1);
+        ExtendedListItem* createRun(const int keys[], int count);     // count items in one piece, linked in order
+        void setHeight(ExtendedListItem* item, int height);     // new tower with all links nullptr
+        void destroy(ExtendedListItem* item);
+        void release(ExtendedListItem* first, ExtendedListItem* last);     // first..last linked by next, no towers
+
+        static void resolve(std::shared_ptr<ListItemSlab>& slab);
+        static void merge(std::shared_ptr<ListItemSlab>& into, std::shared_ptr<ListItemSlab>& other);
+
+        [[nodiscard]] size_t getBlockCount() const;
+
+    private:
+        std::vector<char*> blocks;
+        size_t usedInLastBlock;                     // bytes handed out of blocks.back() so far
+        ExtendedListItem* freeItems;                // chained through next
+        ExtendedListItem* lastFreeItem;
+        ExtendedListItem** freeTowers[maxHeight + 1];   // freeTowers[h]: towers of items with height h, chained through tower[0]
+        ExtendedListItem** lastFreeTower[maxHeight + 1];
+        std::shared_ptr<ListItemSlab> forward;      // set once this slab was merged into another one
+
+        void* bump(size_t bytes);
+        void freeTower(ExtendedListItem** tower, int height);
+        static ExtendedListItem** getNextTower(ExtendedListItem** tower);
+        static void setNextTower(ExtendedListItem** tower, ExtendedListItem** next);
+};
+
+inline void ListItemSlab::resolve(std::shared_ptr<ListItemSlab>& slab) {
+    while(slab->forward != nullptr) {
+        slab = slab->forward;
+    }
+}
+
+#endif //AUFGABE_2_2_LISTITEMSLAB_H
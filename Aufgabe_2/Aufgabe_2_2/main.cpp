@@ -1,4 +1,13 @@
 #include "doublyLinkedList.h"
+#include "unrolledLinkedList.h"
+#include "concurrentList.h"
+#include "compactList.h"
+#include <chrono>
+#include <mutex>
+#include <memory>
+#include <random>
+#include <thread>
+#include <vector>
 
 int main() {
 
@@ -53,4 +62,186 @@ int main() {
     std::cout << "Printing out list without 42" << std::endl;
     list.print();
 
+
+    // with the skip-list index every sorted insert only walks O(log n) items instead of the whole list
+    DoublyLinkedList bigList;
+    bigList.buildIndex();
+    std::mt19937 generator(42);
+    auto start = std::chrono::steady_clock::now();
+    for(int i = 0; i < 1000000; i++) {
+        bigList.insertSorted((int)(generator() % 10000000));
+    }
+    auto end = std::chrono::steady_clock::now();
+    std::cout << "Sorted insert of 1000000 random keys with index: "
+              << std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count() << " ms" << std::endl;
+
+    bigList.insertSorted(4711);
+    std::cout << "Search 4711: " << (bigList.search(4711) != nullptr ? "found" : "not found") << std::endl;
+    bigList.deleteItem(4711);
+    std::cout << "Search 4711 after delete: " << (bigList.search(4711) != nullptr ? "found" : "not found") << std::endl;
+
+
+    // the unrolled list keeps 32 keys per node: a scan reads consecutive ints instead of chasing one pointer per key
+    UnrolledLinkedList unrolled;
+    for(ExtendedListItem* item = bigList.head; item != nullptr; item = item->next) {
+        unrolled.insertAtEnd(item->key);
+    }
+    long long listSum = 0;
+    start = std::chrono::steady_clock::now();
+    for(ExtendedListItem* item = bigList.head; item != nullptr; item = item->next) {
+        listSum += item->key;
+    }
+    end = std::chrono::steady_clock::now();
+    std::cout << "Scan DoublyLinkedList: " << std::chrono::duration_cast<std::chrono::microseconds>(end - start).count()
+              << " us, " << sizeof(ExtendedListItem) << " bytes per key (without towers and allocator overhead)" << std::endl;
+
+    long long unrolledSum = 0;
+    start = std::chrono::steady_clock::now();
+    unrolled.forEach([&unrolledSum](int key) { unrolledSum += key; });
+    end = std::chrono::steady_clock::now();
+    std::cout << "Scan UnrolledLinkedList: " << std::chrono::duration_cast<std::chrono::microseconds>(end - start).count()
+              << " us, " << (double)unrolled.memoryUsage() / (double)unrolled.size() << " bytes per key" << std::endl;
+    std::cout << "Same sum: " << (listSum == unrolledSum ? "yes" : "no") << std::endl;
+
+    UnrolledLinkedList small;
+    small.insertSorted(5);
+    small.insertSorted(1);
+    small.insertSorted(9);
+    UnrolledLinkedList smallInsert;
+    smallInsert.insertAtEnd(2);
+    smallInsert.insertAtEnd(3);
+    small.splice(&smallInsert, 1);
+    small.deleteItem(9);
+    std::cout << "Printing out unrolled list" << std::endl;
+    small.print();
+
+
+    // items of bigList come from its slab: refilling the cleared list needs no malloc, and a list without towers
+    // hands its whole chain back to the slab at once
+    bigList.clear();
+    DoublyLinkedList refill(bigList.getSlab());
+    start = std::chrono::steady_clock::now();
+    for(int i = 0; i < 1000000; i++) {
+        refill.insertAtEnd(i);
+    }
+    end = std::chrono::steady_clock::now();
+    std::cout << "Refill 1000000 items from the free list: "
+              << std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count() << " ms" << std::endl;
+
+    start = std::chrono::steady_clock::now();
+    refill.clear();
+    end = std::chrono::steady_clock::now();
+    std::cout << "Clear 1000000 items: " << std::chrono::duration_cast<std::chrono::microseconds>(end - start).count()
+              << " us" << std::endl;
+
+
+    // sort relinks the items of an unsorted list, mergeSorted combines two sorted lists without re-inserting
+    for(int i = 0; i < 1000000; i++) {
+        refill.insertAtEnd((int)(generator() % 10000000));
+    }
+    start = std::chrono::steady_clock::now();
+    refill.sort();
+    end = std::chrono::steady_clock::now();
+    std::cout << "Sort 1000000 random keys: "
+              << std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count() << " ms" << std::endl;
+
+    DoublyLinkedList evens(refill.getSlab());
+    for(int i = 0; i < 1000000; i += 2) {
+        evens.insertAtEnd(i * 10);
+    }
+    start = std::chrono::steady_clock::now();
+    refill.mergeSorted(&evens);
+    end = std::chrono::steady_clock::now();
+    std::cout << "Merge 500000 sorted keys into it: "
+              << std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count() << " ms" << std::endl;
+
+    std::vector<int> batch(100000);
+    for(int & key : batch) {
+        key = (int)(generator() % 10000000);
+    }
+    start = std::chrono::steady_clock::now();
+    refill.insertSortedBatch(batch.data(), (int)batch.size());
+    end = std::chrono::steady_clock::now();
+    std::cout << "Batch insert of 100000 random keys into 1500000: "
+              << std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count() << " ms" << std::endl;
+
+    std::cout << "Printing out the first five keys" << std::endl;
+    ExtendedListItem* item = refill.head;
+    for(int i = 0; i < 5 && item != nullptr; i++, item = item->next) {
+        std::cout << item->key << " ";
+    }
+    std::cout << std::endl;
+
+
+    // one producer thread, one consumer thread: lock-free queue against the list behind a mutex
+    const int pipelineKeys = 2000000;
+    ConcurrentList queue;
+    long long consumed = 0;
+    start = std::chrono::steady_clock::now();
+    std::thread producer([&queue, pipelineKeys]() {
+        for(int i = 0; i < pipelineKeys; i++) {
+            queue.insertAtEnd(i);
+        }
+    });
+    for(int received = 0, key; received < pipelineKeys;) {
+        if(queue.removeAtStart(key)) {
+            consumed += key;
+            received++;
+        }
+    }
+    producer.join();
+    end = std::chrono::steady_clock::now();
+    std::cout << "ConcurrentList pipeline: " << std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count()
+              << " ms, sum " << consumed << std::endl;
+
+    DoublyLinkedList lockedList;
+    std::mutex listMutex;
+    consumed = 0;
+    start = std::chrono::steady_clock::now();
+    std::thread lockedProducer([&lockedList, &listMutex, pipelineKeys]() {
+        for(int i = 0; i < pipelineKeys; i++) {
+            std::lock_guard<std::mutex> lock(listMutex);
+            lockedList.insertAtEnd(i);
+        }
+    });
+    for(int received = 0; received < pipelineKeys;) {
+        std::lock_guard<std::mutex> lock(listMutex);
+        if(lockedList.head != nullptr) {
+            consumed += lockedList.head->key;
+            lockedList.deleteItem(lockedList.head->key);
+            received++;
+        }
+    }
+    lockedProducer.join();
+    end = std::chrono::steady_clock::now();
+    std::cout << "DoublyLinkedList with mutex pipeline: "
+              << std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count() << " ms, sum " << consumed
+              << std::endl;
+
+
+    // 16 lists filled round robin share one store: the slots of one list lie 16 apart until compact() sorts them
+    CompactListStore store;
+    std::vector<std::unique_ptr<CompactList>> compactLists;
+    for(int i = 0; i < 16; i++) {
+        compactLists.emplace_back(new CompactList(store));
+    }
+    for(int i = 0; i < 1000000; i++) {
+        compactLists[i % 16]->insertAtEnd(i);
+    }
+    std::cout << "CompactListStore: " << (double)store.memoryUsage() / (double)store.size() << " bytes per key" << std::endl;
+    for(int pass = 0; pass < 2; pass++) {
+        long long compactSum = 0;
+        start = std::chrono::steady_clock::now();
+        for(auto & compactList : compactLists) {
+            compactList->forEach([&compactSum](int key) { compactSum += key; });
+        }
+        end = std::chrono::steady_clock::now();
+        std::cout << (pass == 0 ? "Scan before compact: " : "Scan after compact: ")
+                  << std::chrono::duration_cast<std::chrono::microseconds>(end - start).count() << " us, sum "
+                  << compactSum << std::endl;
+        store.compact();
+    }
+    compactLists[0]->splice(compactLists[1].get(), 2);     // same store: only relinks
+    std::cout << "List 0 after splicing list 1 in at position 2: " << compactLists[0]->size() << " keys" << std::endl;
+
 }
\ No newline at end of file
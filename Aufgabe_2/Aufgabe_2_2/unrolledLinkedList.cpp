@@ -0,0 +1,287 @@
+#include "unrolledLinkedList.h"
+#include <algorithm>
+#include <cstring>
+
+UnrolledNode::UnrolledNode() {
+    this->next = nullptr;
+    this->previous = nullptr;
+    this->count = 0;
+}
+
+UnrolledLinkedList::UnrolledLinkedList() {
+    this->head = nullptr;
+    this->tail = nullptr;
+    this->keyCount = 0;
+    this->nodeCount = 0;
+}
+
+UnrolledLinkedList::~UnrolledLinkedList() {
+    UnrolledNode* current = this->head;
+    while(current != nullptr) {
+        UnrolledNode* next = current->next;
+        delete current;
+        current = next;
+    }
+}
+
+UnrolledNode* UnrolledLinkedList::insertNodeAfter(UnrolledNode* node) {
+    auto* newNode = new UnrolledNode();
+    newNode->previous = node;
+    newNode->next = node == nullptr ? this->head : node->next;
+    if(newNode->next != nullptr) {
+        newNode->next->previous = newNode;
+    } else {
+        this->tail = newNode;
+    }
+    if(node != nullptr) {
+        node->next = newNode;
+    } else {
+        this->head = newNode;
+    }
+    this->nodeCount++;
+    return newNode;
+}
+
+void UnrolledLinkedList::removeNode(UnrolledNode* node) {
+    if(node->previous != nullptr) {
+        node->previous->next = node->next;
+    } else {
+        this->head = node->next;
+    }
+    if(node->next != nullptr) {
+        node->next->previous = node->previous;
+    } else {
+        this->tail = node->previous;
+    }
+    delete node;
+    this->nodeCount--;
+}
+
+UnrolledNode* UnrolledLinkedList::split(UnrolledNode* node, int at) {
+    UnrolledNode* newNode = this->insertNodeAfter(node);
+    std::memcpy(newNode->keys, node->keys + at, (node->count - at) * sizeof(int));
+    newNode->count = node->count - at;
+    node->count = at;
+    return newNode;
+}
+
+// insert key in front of node->keys[index], a full node is split in the middle first
+void UnrolledLinkedList::insertAt(UnrolledNode* node, int index, int key) {
+    if(node->count == UnrolledNode::capacity) {
+        int half = UnrolledNode::capacity / 2;
+        UnrolledNode* upper = this->split(node, half);
+        if(index > half) {
+            node = upper;
+            index -= half;
+        }
+    }
+    std::memmove(node->keys + index + 1, node->keys + index, (node->count - index) * sizeof(int));
+    node->keys[index] = key;
+    node->count++;
+    this->keyCount++;
+}
+
+void UnrolledLinkedList::insertAtStart(int key) {
+    // a full head gets a new node in front instead of being split, so repeated inserts at the start fill whole nodes
+    if(this->head == nullptr || this->head->count == UnrolledNode::capacity) {
+        this->insertNodeAfter(nullptr);
+    }
+    this->insertAt(this->head, 0, key);
+}
+
+void UnrolledLinkedList::insertAtEnd(int key) {
+    if(this->tail == nullptr || this->tail->count == UnrolledNode::capacity) {
+        this->insertNodeAfter(this->tail);
+    }
+    this->insertAt(this->tail, this->tail->count, key);
+}
+
+void UnrolledLinkedList::insertSorted(int key) {
+    // list is empty OR new is smaller than the first key => insert at front
+    if(this->head == nullptr || key < this->head->keys[0]) {
+        this->insertAtStart(key);
+        return;
+    }
+
+    // new key is not smaller than the last key => insert at end
+    if(key >= this->tail->keys[this->tail->count - 1]) {
+        this->insertAtEnd(key);
+        return;
+    }
+
+    // first node with a larger key than the new one, only its last key has to be compared to skip a node
+    UnrolledNode* current = this->head;
+    while(current->keys[current->count - 1] <= key) {
+        current = current->next;
+    }
+    int index = (int)(std::upper_bound(current->keys, current->keys + current->count, key) - current->keys);
+
+    // the new key goes right behind the previous node: fill that one up before splitting this one
+    if(index == 0 && current->previous != nullptr && current->previous->count < UnrolledNode::capacity) {
+        current = current->previous;
+        index = current->count;
+    }
+    this->insertAt(current, index, key);
+}
+
+// merge a node below half capacity into a neighbour if the keys of both fit into one node
+void UnrolledLinkedList::mergeIfSparse(UnrolledNode* node) {
+    if(node->count >= UnrolledNode::capacity / 2) {
+        return;
+    }
+    if(node->next != nullptr && node->count + node->next->count <= UnrolledNode::capacity) {
+        UnrolledNode* next = node->next;
+        std::memcpy(node->keys + node->count, next->keys, next->count * sizeof(int));
+        node->count += next->count;
+        this->removeNode(next);
+    } else if(node->previous != nullptr && node->previous->count + node->count <= UnrolledNode::capacity) {
+        UnrolledNode* previous = node->previous;
+        std::memcpy(previous->keys + previous->count, node->keys, node->count * sizeof(int));
+        previous->count += node->count;
+        this->removeNode(node);
+    }
+}
+
+// first node whose last key is not smaller than key: only that node can hold key, nullptr if none can
+UnrolledNode* UnrolledLinkedList::nodeFor(int key) const {
+    UnrolledNode* current = this->head;
+    while(current != nullptr && current->keys[current->count - 1] < key) {
+        current = current->next;
+    }
+    return current;
+}
+
+void UnrolledLinkedList::deleteItem(int key) {
+    UnrolledNode* current = this->nodeFor(key);
+    if(current != nullptr) {
+        int* found = std::lower_bound(current->keys, current->keys + current->count, key);
+        if(*found == key) {
+            int index = (int)(found - current->keys);
+            std::memmove(found, found + 1, (current->count - index - 1) * sizeof(int));
+            current->count--;
+            this->keyCount--;
+
+            if(current->count == 0) {
+                this->removeNode(current);
+            } else {
+                this->mergeIfSparse(current);
+            }
+            return;
+        }
+    }
+    std::cout << "Item not found!" << std::endl;
+}
+
+bool UnrolledLinkedList::contains(int key) const {
+    const UnrolledNode* current = this->nodeFor(key);
+    return current != nullptr && *std::lower_bound(current->keys, current->keys + current->count, key) == key;
+}
+
+void UnrolledLinkedList::append(UnrolledLinkedList* appendingList) {
+    if(appendingList->head == nullptr) {
+        return;
+    }
+    UnrolledNode* seam = this->tail;
+
+    // set the pointers correctly
+    if(this->tail == nullptr) {
+        this->head = appendingList->head;
+    } else {
+        this->tail->next = appendingList->head;
+        appendingList->head->previous = this->tail;
+    }
+    this->tail = appendingList->tail;
+    this->keyCount += appendingList->keyCount;
+    this->nodeCount += appendingList->nodeCount;
+
+    // clear the appending list
+    appendingList->head = nullptr;
+    appendingList->tail = nullptr;
+    appendingList->keyCount = 0;
+    appendingList->nodeCount = 0;
+
+    if(seam != nullptr) {
+        this->mergeIfSparse(seam);
+    }
+}
+
+// the keys of insertingList end up in front of the key at position (0 = in front of the first key)
+void UnrolledLinkedList::splice(UnrolledLinkedList* insertingList, int position) {
+    if(insertingList->head == nullptr) {
+        return;
+    }
+    if(position >= (int)this->keyCount) {
+        this->append(insertingList);
+        return;
+    }
+    if(position <= 0) {
+        // prepend: append this list to the inserting one and take over the result
+        insertingList->append(this);
+        std::swap(this->head, insertingList->head);
+        std::swap(this->tail, insertingList->tail);
+        std::swap(this->keyCount, insertingList->keyCount);
+        std::swap(this->nodeCount, insertingList->nodeCount);
+        return;
+    }
+
+    // find the node holding position, a position inside a node splits it
+    UnrolledNode* current = this->head;
+    while(position >= current->count) {
+        position -= current->count;
+        current = current->next;
+    }
+    UnrolledNode* prev;
+    if(position == 0) {
+        prev = current->previous;
+    } else {
+        this->split(current, position);
+        prev = current;
+        current = current->next;
+    }
+
+    // set the pointers correctly
+    prev->next = insertingList->head;
+    insertingList->head->previous = prev;
+    insertingList->tail->next = current;
+    current->previous = insertingList->tail;
+    this->keyCount += insertingList->keyCount;
+    this->nodeCount += insertingList->nodeCount;
+
+    // clear the inserting list
+    insertingList->head = nullptr;
+    insertingList->tail = nullptr;
+    insertingList->keyCount = 0;
+    insertingList->nodeCount = 0;
+}
+
+void UnrolledLinkedList::print() const {
+    if(this->head == nullptr) {
+        std::cout << "<Empty List>" << std::endl << std::endl;
+        return;
+    }
+
+    for(const UnrolledNode* current = this->head; current != nullptr; current = current->next) {
+        std::cout << "Knotenpointer: " << current << "    Objekte:";
+        for(int i = 0; i < current->count; i++) {
+            std::cout << " " << current->keys[i];
+        }
+        std::cout << "    previous knoten: " << current->previous << " next knoten: " << current->next;
+
+        if(current->next != nullptr) {
+            std::cout << " -> " << std::endl;
+        }
+    }
+    std::cout << std::endl << std::endl;
+}
+
+size_t UnrolledLinkedList::size() const {
+    return this->keyCount;
+}
+
+size_t UnrolledLinkedList::getNodeCount() const {
+    return this->nodeCount;
+}
+
+size_t UnrolledLinkedList::memoryUsage() const {
+    return this->nodeCount * sizeof(UnrolledNode);
+}
@@ -0,0 +1,74 @@
+#ifndef AUFGABE_2_2_UNROLLEDLINKEDLIST_H
+#define AUFGABE_2_2_UNROLLEDLINKEDLIST_H
+
+#include <cstddef>
+#include <iostream>
+
+/*  --
+    Unrolled variant of DoublyLinkedList: every node holds up to nodeCapacity keys in an array, so a traversal
+    reads whole cache lines of keys instead of following one pointer per key.
+    Same API as DoublyLinkedList, positions (splice) count keys, not nodes.
+    - a full node is split into two halves before a key is inserted into it,
+    - a node that drops below half full after deleteItem is merged with a neighbour if both fit into one node,
+      an empty node is always removed,
+    so apart from a few nodes at the ends (insertAtStart/insertAtEnd, splice) nodes stay at least half full.
+    deleteItem and contains expect the keys sorted, as insertSorted keeps them: they skip every node whose last key
+    is smaller and binary search the one node that can hold the key.
+--  */
+struct UnrolledNode {
+    static const int capacity = 32;
+
+    UnrolledNode* next;
+    UnrolledNode* previous;
+    int count;
+    int keys[capacity];
+
+    UnrolledNode();
+};
+
+struct UnrolledLinkedList {
+public:
+    UnrolledLinkedList();
+    UnrolledLinkedList(const UnrolledLinkedList&) = delete;
+    UnrolledLinkedList& operator=(const UnrolledLinkedList&) = delete;
+    ~UnrolledLinkedList();
+
+    UnrolledNode* head;
+    UnrolledNode* tail;
+    void insertSorted(int key);
+
+    void append(UnrolledLinkedList* appendingList);
+    void splice(UnrolledLinkedList* insertingList, int position);
+    void insertAtStart(int key);
+    void insertAtEnd(int key);
+    void deleteItem(int key);
+    bool contains(int key) const;
+    void print() const;
+
+    [[nodiscard]] size_t size() const;
+    [[nodiscard]] size_t getNodeCount() const;
+    [[nodiscard]] size_t memoryUsage() const;   // bytes of all nodes, without allocator overhead
+
+    // calls visit(key) for every key from head to tail
+    template<typename Visit>
+    void forEach(Visit visit) const {
+        for(const UnrolledNode* node = this->head; node != nullptr; node = node->next) {
+            for(int i = 0; i < node->count; i++) {
+                visit(node->keys[i]);
+            }
+        }
+    }
+
+private:
+    size_t keyCount;
+    size_t nodeCount;
+
+    UnrolledNode* insertNodeAfter(UnrolledNode* node);     // node nullptr: new head
+    UnrolledNode* nodeFor(int key) const;
+    void removeNode(UnrolledNode* node);
+    UnrolledNode* split(UnrolledNode* node, int at);        // keys from at move into a new node behind node
+    void insertAt(UnrolledNode* node, int index, int key);
+    void mergeIfSparse(UnrolledNode* node);
+};
+
+#endif //AUFGABE_2_2_UNROLLEDLINKEDLIST_H
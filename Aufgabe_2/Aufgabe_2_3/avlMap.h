@@ -0,0 +1,646 @@
+#ifndef AUFGABE_2_3_AVLMAP_H
+#define AUFGABE_2_3_AVLMAP_H
+
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <tuple>
+#include <utility>
+
+/*  --
+    Augmentation policies for AvlMap. Every node stores the policy's Data for its subtree, computed from the
+    mapped values in key order: make(value) for a single node, combine(left, right) for two adjacent ranges.
+    The Data is a base class of the node, so the empty NoAugment::Data takes no space (empty base optimisation).
+--  */
+struct NoAugment {
+    static constexpr bool enabled = false;
+    struct Data {};
+
+    template<typename V>
+    static Data make(const V&) { return {}; }
+    static Data combine(const Data&, const Data&) { return {}; }
+};
+
+//  number of nodes in the subtree, enough for select and rank
+struct SubtreeSize {
+    static constexpr bool enabled = true;
+    struct Data {
+        std::size_t size;
+    };
+
+    template<typename V>
+    static Data make(const V&) { return {1}; }
+    static Data combine(const Data& left, const Data& right) { return {left.size + right.size}; }
+};
+
+//  size plus sum, minimum and maximum of the mapped values; V needs +, < and V() as zero
+template<typename V>
+struct SubtreeAggregate {
+    static constexpr bool enabled = true;
+    struct Data {
+        std::size_t size;
+        V sum;
+        V min;
+        V max;
+    };
+
+    static Data make(const V& value) { return {1, value, value, value}; }
+    static Data combine(const Data& left, const Data& right) {
+        return {left.size + right.size, left.sum + right.sum,
+                right.min < left.min ? right.min : left.min,
+                left.max < right.max ? right.max : left.max};
+    }
+};
+
+/*  --
+    Ordered map on an AVL tree, in the spirit of std::map:
+        - insert and erase are iterative; the links passed on the way down are kept on a fixed-size stack
+          (an AVL tree of 2^64 nodes is less than 93 levels high) and rebalanced on the way back up,
+        - nodes have no parent pointer; ++/-- on an iterator walk down the subtree or search the
+          successor/predecessor from the root, O(log n) worst case,
+        - erase relinks nodes instead of copying keys, so iterators to all other elements stay valid,
+        - nodes are allocated through Allocator (rebound to the node type),
+        - with an Augment policy other than NoAugment, rotations, insert and erase also recompute the policy's
+          Data along the whole path; select and rank (SubtreeSize or SubtreeAggregate) and rangeAggregate/rangeSum
+          (SubtreeAggregate) then run in O(log n). Mapped values changed through a reference (operator[], at,
+          iterators) are not seen by the aggregates, use insert_or_assign for that.
+--  */
+template<typename K, typename V, typename Compare = std::less<K>,
+         typename Allocator = std::allocator<std::pair<const K, V>>, typename Augment = NoAugment>
+class AvlMap {
+    public:
+        using key_type = K;
+        using mapped_type = V;
+        using value_type = std::pair<const K, V>;
+        using size_type = std::size_t;
+        using key_compare = Compare;
+        using allocator_type = Allocator;
+        using augment_type = Augment;
+        using augment_data = typename Augment::Data;
+
+    private:
+        struct Node : augment_data {
+            value_type value;
+            Node* left;
+            Node* right;
+            int height;
+
+            template<typename... Args>
+            explicit Node(Args&&... args)
+                : augment_data(), value(std::forward<Args>(args)...), left(nullptr), right(nullptr), height(1) {}
+        };
+
+        using NodeAllocator = typename std::allocator_traits<Allocator>::template rebind_alloc<Node>;
+        using NodeTraits = std::allocator_traits<NodeAllocator>;
+
+        static const int maxHeight = 96;
+
+    public:
+        template<bool IsConst>
+        class Iterator {
+            public:
+                using iterator_category = std::bidirectional_iterator_tag;
+                using value_type = typename AvlMap::value_type;
+                using difference_type = std::ptrdiff_t;
+                using pointer = typename std::conditional<IsConst, const value_type*, value_type*>::type;
+                using reference = typename std::conditional<IsConst, const value_type&, value_type&>::type;
+
+                Iterator() : node(nullptr), map(nullptr) {}
+                template<bool OtherConst, typename = typename std::enable_if<IsConst && !OtherConst>::type>
+                Iterator(const Iterator<OtherConst>& other) : node(other.node), map(other.map) {}
+
+                reference operator*() const { return this->node->value; }
+                pointer operator->() const { return &this->node->value; }
+
+                Iterator& operator++() {
+                    this->node = this->map->successor(this->node);
+                    return *this;
+                }
+                Iterator operator++(int) {
+                    Iterator old = *this;
+                    ++*this;
+                    return old;
+                }
+                Iterator& operator--() {
+                    this->node = this->node == nullptr ? this->map->maximum(this->map->root)
+                                                       : this->map->predecessor(this->node);
+                    return *this;
+                }
+                Iterator operator--(int) {
+                    Iterator old = *this;
+                    --*this;
+                    return old;
+                }
+
+                template<bool OtherConst>
+                bool operator==(const Iterator<OtherConst>& other) const { return this->node == other.node; }
+                template<bool OtherConst>
+                bool operator!=(const Iterator<OtherConst>& other) const { return this->node != other.node; }
+
+            private:
+                friend class AvlMap;
+                template<bool> friend class Iterator;
+                Iterator(Node* node, const AvlMap* map) : node(node), map(map) {}
+
+                Node* node;             //  nullptr is end()
+                const AvlMap* map;
+        };
+
+        using iterator = Iterator<false>;
+        using const_iterator = Iterator<true>;
+
+        AvlMap() : AvlMap(Compare()) {}
+        explicit AvlMap(const Compare& compare, const Allocator& allocator = Allocator())
+            : root(nullptr), count(0), compare(compare), allocator(allocator) {}
+
+        AvlMap(const AvlMap& other)
+            : root(nullptr), count(0), compare(other.compare),
+              allocator(NodeTraits::select_on_container_copy_construction(other.allocator)) {
+            this->root = this->clone(other.root);
+            this->count = other.count;
+        }
+
+        AvlMap(AvlMap&& other) noexcept
+            : root(other.root), count(other.count), compare(std::move(other.compare)), allocator(std::move(other.allocator)) {
+            other.root = nullptr;
+            other.count = 0;
+        }
+
+        AvlMap& operator=(AvlMap other) {
+            this->swap(other);
+            return *this;
+        }
+
+        ~AvlMap() {
+            this->clear();
+        }
+
+        void swap(AvlMap& other) noexcept {
+            std::swap(this->root, other.root);
+            std::swap(this->count, other.count);
+            std::swap(this->compare, other.compare);
+            std::swap(this->allocator, other.allocator);
+        }
+
+        size_type size() const { return this->count; }
+        bool empty() const { return this->count == 0; }
+
+        void clear() {
+            this->destroyTree(this->root);
+            this->root = nullptr;
+            this->count = 0;
+        }
+
+        iterator begin() { return iterator(this->minimum(this->root), this); }
+        iterator end() { return iterator(nullptr, this); }
+        const_iterator begin() const { return const_iterator(this->minimum(this->root), this); }
+        const_iterator end() const { return const_iterator(nullptr, this); }
+        const_iterator cbegin() const { return this->begin(); }
+        const_iterator cend() const { return this->end(); }
+
+        iterator find(const K& key) { return iterator(this->findNode(key), this); }
+        const_iterator find(const K& key) const { return const_iterator(this->findNode(key), this); }
+        bool contains(const K& key) const { return this->findNode(key) != nullptr; }
+
+        //  first element whose key is not less than key
+        iterator lower_bound(const K& key) { return iterator(this->lowerBound(key), this); }
+        const_iterator lower_bound(const K& key) const { return const_iterator(this->lowerBound(key), this); }
+
+        //  first element whose key is greater than key
+        iterator upper_bound(const K& key) { return iterator(this->upperBound(key), this); }
+        const_iterator upper_bound(const K& key) const { return const_iterator(this->upperBound(key), this); }
+
+        V& at(const K& key) {
+            Node* node = this->findNode(key);
+            if(node == nullptr) {
+                throw std::out_of_range("AvlMap::at: key not found");
+            }
+            return node->value.second;
+        }
+        const V& at(const K& key) const {
+            return const_cast<AvlMap*>(this)->at(key);
+        }
+
+        V& operator[](const K& key) {
+            return this->emplace(std::piecewise_construct, std::forward_as_tuple(key), std::forward_as_tuple())
+                       .first->second;
+        }
+
+        std::pair<iterator, bool> insert(const value_type& value) { return this->emplace(value); }
+        std::pair<iterator, bool> insert(value_type&& value) { return this->emplace(std::move(value)); }
+
+        //  the node is built before the search, so the key is compared in its final form; it is released again
+        //  if an equal key already exists
+        template<typename... Args>
+        std::pair<iterator, bool> emplace(Args&&... args) {
+            Node* node = this->createNode(std::forward<Args>(args)...);
+            const K& key = node->value.first;
+
+            Node** path[maxHeight];
+            int depth = 0;
+            Node** link = &this->root;
+            while(*link != nullptr) {
+                path[depth++] = link;
+                if(this->compare(key, (*link)->value.first)) {
+                    link = &(*link)->left;
+                } else if(this->compare((*link)->value.first, key)) {
+                    link = &(*link)->right;
+                } else {
+                    Node* existing = *link;
+                    this->destroyNode(node);
+                    return {iterator(existing, this), false};
+                }
+            }
+            *link = node;
+            this->count++;
+
+            //  walk back up; once a subtree keeps its height, nothing above it changes (except the aggregates)
+            while(depth > 0) {
+                Node** parentLink = path[--depth];
+                int oldHeight = (*parentLink)->height;
+                *parentLink = this->rebalance(*parentLink);
+                if(!Augment::enabled && (*parentLink)->height == oldHeight) {
+                    break;
+                }
+            }
+            return {iterator(node, this), true};
+        }
+
+        size_type erase(const K& key) {
+            Node** path[maxHeight];
+            int depth = 0;
+            Node** link = &this->root;
+            while(*link != nullptr) {
+                if(this->compare(key, (*link)->value.first)) {
+                    path[depth++] = link;
+                    link = &(*link)->left;
+                } else if(this->compare((*link)->value.first, key)) {
+                    path[depth++] = link;
+                    link = &(*link)->right;
+                } else {
+                    break;
+                }
+            }
+            if(*link == nullptr) {
+                return 0;
+            }
+
+            Node* target = *link;
+            if(target->left != nullptr && target->right != nullptr) {
+                //  the in-order successor (minimum of the right subtree) takes the place of target
+                int targetDepth = depth;
+                path[depth++] = link;
+                Node** successorLink = &target->right;
+                while((*successorLink)->left != nullptr) {
+                    path[depth++] = successorLink;
+                    successorLink = &(*successorLink)->left;
+                }
+                Node* successor = *successorLink;
+                *successorLink = successor->right;
+                successor->left = target->left;
+                successor->right = target->right;
+                successor->height = target->height;
+                *link = successor;
+                if(depth > targetDepth + 1) {
+                    path[targetDepth + 1] = &successor->right;  //  was &target->right
+                }
+            } else {
+                *link = target->left != nullptr ? target->left : target->right;
+            }
+            this->destroyNode(target);
+            this->count--;
+
+            //  walk back up; unlike insert, a rotation may shorten the subtree, so stop only on an unchanged height
+            while(depth > 0) {
+                Node** parentLink = path[--depth];
+                int oldHeight = (*parentLink)->height;
+                *parentLink = this->rebalance(*parentLink);
+                if(!Augment::enabled && (*parentLink)->height == oldHeight) {
+                    break;
+                }
+            }
+            return 1;
+        }
+
+        iterator erase(const_iterator position) {
+            iterator next(this->successor(position.node), this);
+            this->erase(position.node->value.first);
+            return next;
+        }
+
+        //  inserts or overwrites the mapped value and refreshes the aggregates on the path to it
+        template<typename M>
+        std::pair<iterator, bool> insert_or_assign(const K& key, M&& value) {
+            Node** path[maxHeight];
+            int depth = 0;
+            Node** link = &this->root;
+            while(*link != nullptr) {
+                path[depth++] = link;
+                if(this->compare(key, (*link)->value.first)) {
+                    link = &(*link)->left;
+                } else if(this->compare((*link)->value.first, key)) {
+                    link = &(*link)->right;
+                } else {
+                    (*link)->value.second = std::forward<M>(value);
+                    Node* node = *link;
+                    while(depth > 0) {
+                        update(*path[--depth]);
+                    }
+                    return {iterator(node, this), false};
+                }
+            }
+            return this->emplace(key, std::forward<M>(value));
+        }
+
+        //  element with index k in key order (0 is the smallest key), end() if k >= size()
+        iterator select(size_type k) { return iterator(this->selectNode(k), this); }
+        const_iterator select(size_type k) const { return const_iterator(this->selectNode(k), this); }
+
+        //  number of elements whose key is less than key
+        size_type rank(const K& key) const {
+            size_type result = 0;
+            const Node* node = this->root;
+            while(node != nullptr) {
+                if(this->compare(node->value.first, key)) {
+                    result += subtreeSize(node->left) + 1;
+                    node = node->right;
+                } else {
+                    node = node->left;
+                }
+            }
+            return result;
+        }
+
+        //  Data of all elements with lo <= key <= hi; size is 0 for an empty range (the other fields are then V())
+        augment_data rangeAggregate(const K& lo, const K& hi) const {
+            augment_data result{};
+            bool found = false;
+            this->collect(this->root, lo, hi, false, false, result, found);
+            return result;
+        }
+
+        //  sum of the mapped values of all elements with lo <= key <= hi
+        V rangeSum(const K& lo, const K& hi) const {
+            return this->rangeAggregate(lo, hi).sum;
+        }
+
+        //  Data of the whole map
+        augment_data aggregate() const {
+            return this->root == nullptr ? augment_data{} : augmentOf(this->root);
+        }
+
+        key_compare key_comp() const { return this->compare; }
+        allocator_type get_allocator() const { return allocator_type(this->allocator); }
+
+        int height() const { return getHeight(this->root); }
+
+    private:
+        Node* root;
+        size_type count;
+        Compare compare;
+        NodeAllocator allocator;
+
+        template<typename... Args>
+        Node* createNode(Args&&... args) {
+            Node* node = NodeTraits::allocate(this->allocator, 1);
+            try {
+                NodeTraits::construct(this->allocator, node, std::forward<Args>(args)...);
+            } catch(...) {
+                NodeTraits::deallocate(this->allocator, node, 1);
+                throw;
+            }
+            update(node);
+            return node;
+        }
+
+        void destroyNode(Node* node) {
+            NodeTraits::destroy(this->allocator, node);
+            NodeTraits::deallocate(this->allocator, node, 1);
+        }
+
+        //  recursion depth is bounded by the height of the tree
+        void destroyTree(Node* node) {
+            if(node == nullptr) {
+                return;
+            }
+            this->destroyTree(node->left);
+            this->destroyTree(node->right);
+            this->destroyNode(node);
+        }
+
+        Node* clone(const Node* node) {
+            if(node == nullptr) {
+                return nullptr;
+            }
+            Node* copy = this->createNode(node->value);
+            copy->height = node->height;
+            try {
+                copy->left = this->clone(node->left);
+                copy->right = this->clone(node->right);
+            } catch(...) {
+                this->destroyTree(copy);
+                throw;
+            }
+            update(copy);
+            return copy;
+        }
+
+        static int getHeight(const Node* node) {
+            return node == nullptr ? 0 : node->height;
+        }
+
+        static const augment_data& augmentOf(const Node* node) {
+            return *node;
+        }
+
+        static size_type subtreeSize(const Node* node) {
+            return node == nullptr ? 0 : augmentOf(node).size;
+        }
+
+        //  recomputes height and aggregate of node from its children
+        static void update(Node* node) {
+            int left = getHeight(node->left);
+            int right = getHeight(node->right);
+            node->height = 1 + (left > right ? left : right);
+            if constexpr(Augment::enabled) {
+                augment_data data = Augment::make(node->value.second);
+                if(node->left != nullptr) {
+                    data = Augment::combine(augmentOf(node->left), data);
+                }
+                if(node->right != nullptr) {
+                    data = Augment::combine(data, augmentOf(node->right));
+                }
+                static_cast<augment_data&>(*node) = data;
+            }
+        }
+
+        static Node* rotateLeft(Node* node) {
+            Node* rightNode = node->right;
+            node->right = rightNode->left;
+            rightNode->left = node;
+            update(node);
+            update(rightNode);
+            return rightNode;
+        }
+
+        static Node* rotateRight(Node* node) {
+            Node* leftNode = node->left;
+            node->left = leftNode->right;
+            leftNode->right = node;
+            update(node);
+            update(leftNode);
+            return leftNode;
+        }
+
+        //  updates height and aggregate of node and restores the AVL property with a single or double rotation
+        static Node* rebalance(Node* node) {
+            update(node);
+            int diff = getHeight(node->left) - getHeight(node->right);
+            if(diff > 1) {
+                if(getHeight(node->left->left) < getHeight(node->left->right)) {
+                    node->left = rotateLeft(node->left);
+                }
+                return rotateRight(node);
+            }
+            if(diff < -1) {
+                if(getHeight(node->right->right) < getHeight(node->right->left)) {
+                    node->right = rotateRight(node->right);
+                }
+                return rotateLeft(node);
+            }
+            return node;
+        }
+
+        Node* selectNode(size_type k) const {
+            Node* node = this->root;
+            while(node != nullptr) {
+                size_type leftSize = subtreeSize(node->left);
+                if(k < leftSize) {
+                    node = node->left;
+                } else if(k == leftSize) {
+                    return node;
+                } else {
+                    k -= leftSize + 1;
+                    node = node->right;
+                }
+            }
+            return nullptr;
+        }
+
+        void append(augment_data& result, bool& found, const augment_data& data) const {
+            result = found ? Augment::combine(result, data) : data;
+            found = true;
+        }
+
+        /*  Adds the elements of the subtree within [lo, hi] to result. aboveLo/belowHi tell that all keys of the
+            subtree are already known to be >= lo / <= hi; once both hold, the whole subtree is taken from its
+            Data. Only the two search paths to lo and hi are followed, so this is O(log n).
+         */
+        void collect(const Node* node, const K& lo, const K& hi, bool aboveLo, bool belowHi,
+                     augment_data& result, bool& found) const {
+            while(node != nullptr) {
+                if(aboveLo && belowHi) {
+                    this->append(result, found, augmentOf(node));
+                    return;
+                }
+                if(!aboveLo && this->compare(node->value.first, lo)) {
+                    node = node->right;
+                } else if(!belowHi && this->compare(hi, node->value.first)) {
+                    node = node->left;
+                } else {
+                    this->collect(node->left, lo, hi, aboveLo, true, result, found);
+                    this->append(result, found, Augment::make(node->value.second));
+                    aboveLo = true;
+                    node = node->right;
+                }
+            }
+        }
+
+        Node* findNode(const K& key) const {
+            Node* node = this->root;
+            while(node != nullptr) {
+                if(this->compare(key, node->value.first)) {
+                    node = node->left;
+                } else if(this->compare(node->value.first, key)) {
+                    node = node->right;
+                } else {
+                    return node;
+                }
+            }
+            return nullptr;
+        }
+
+        Node* lowerBound(const K& key) const {
+            Node* result = nullptr;
+            Node* node = this->root;
+            while(node != nullptr) {
+                if(!this->compare(node->value.first, key)) {
+                    result = node;
+                    node = node->left;
+                } else {
+                    node = node->right;
+                }
+            }
+            return result;
+        }
+
+        Node* upperBound(const K& key) const {
+            Node* result = nullptr;
+            Node* node = this->root;
+            while(node != nullptr) {
+                if(this->compare(key, node->value.first)) {
+                    result = node;
+                    node = node->left;
+                } else {
+                    node = node->right;
+                }
+            }
+            return result;
+        }
+
+        static Node* minimum(Node* node) {
+            if(node != nullptr) {
+                while(node->left != nullptr) {
+                    node = node->left;
+                }
+            }
+            return node;
+        }
+
+        static Node* maximum(Node* node) {
+            if(node != nullptr) {
+                while(node->right != nullptr) {
+                    node = node->right;
+                }
+            }
+            return node;
+        }
+
+        Node* successor(const Node* node) const {
+            if(node->right != nullptr) {
+                return minimum(node->right);
+            }
+            return this->upperBound(node->value.first);
+        }
+
+        Node* predecessor(const Node* node) const {
+            if(node->left != nullptr) {
+                return maximum(node->left);
+            }
+            Node* result = nullptr;
+            Node* current = this->root;
+            while(current != nullptr) {
+                if(this->compare(current->value.first, node->value.first)) {
+                    result = current;
+                    current = current->right;
+                } else {
+                    current = current->left;
+                }
+            }
+            return result;
+        }
+};
+
+#endif //AUFGABE_2_3_AVLMAP_H
@@ -0,0 +1,221 @@
+#include "avlSetOperations.h"
+#include <future>
+#include <thread>
+
+//  Trees of at least this height (roughly 2^12 nodes) are worth handing to another thread
+static const int parallelHeightCutoff = 12;
+
+//  every level of forking doubles the number of threads: depth = log2(number of cores)
+static int initialThreadDepth() {
+    int threadDepth = 0;
+    for(unsigned int cores = std::thread::hardware_concurrency(); cores > 1; cores /= 2) {
+        threadDepth++;
+    }
+    return threadDepth;
+}
+
+static AvlNode* makeNode(AvlNode* left, AvlNode* middle, AvlNode* right) {
+    middle->left = left;
+    middle->right = right;
+    middle->height = 1 + AvlNode::max(AvlNode::getHeight(left), AvlNode::getHeight(right));
+    return middle;
+}
+
+//  left is more than one level higher than right: walk down the right spine of left until the heights match
+static AvlNode* joinRight(AvlNode* left, AvlNode* middle, AvlNode* right) {
+    AvlNode* leftChild = left->left;
+    AvlNode* rightChild = left->right;
+
+    if(AvlNode::getHeight(rightChild) <= AvlNode::getHeight(right) + 1) {
+        AvlNode* joined = makeNode(rightChild, middle, right);
+        if(AvlNode::getHeight(joined) <= AvlNode::getHeight(leftChild) + 1) {
+            return makeNode(leftChild, left, joined);
+        }
+        return makeNode(leftChild, left, joined->rightRotation())->leftRotation();
+    }
+
+    AvlNode* joined = joinRight(rightChild, middle, right);
+    AvlNode* result = makeNode(leftChild, left, joined);
+    if(AvlNode::getHeight(joined) <= AvlNode::getHeight(leftChild) + 1) {
+        return result;
+    }
+    return result->leftRotation();
+}
+
+//  mirror image of joinRight
+static AvlNode* joinLeft(AvlNode* left, AvlNode* middle, AvlNode* right) {
+    AvlNode* leftChild = right->left;
+    AvlNode* rightChild = right->right;
+
+    if(AvlNode::getHeight(leftChild) <= AvlNode::getHeight(left) + 1) {
+        AvlNode* joined = makeNode(left, middle, leftChild);
+        if(AvlNode::getHeight(joined) <= AvlNode::getHeight(rightChild) + 1) {
+            return makeNode(joined, right, rightChild);
+        }
+        return makeNode(joined->leftRotation(), right, rightChild)->rightRotation();
+    }
+
+    AvlNode* joined = joinLeft(left, middle, leftChild);
+    AvlNode* result = makeNode(joined, right, rightChild);
+    if(AvlNode::getHeight(joined) <= AvlNode::getHeight(rightChild) + 1) {
+        return result;
+    }
+    return result->rightRotation();
+}
+
+AvlNode* avlJoin(AvlNode* left, AvlNode* middle, AvlNode* right) {
+    if(AvlNode::getHeight(left) > AvlNode::getHeight(right) + 1) {
+        return joinRight(left, middle, right);
+    }
+    if(AvlNode::getHeight(right) > AvlNode::getHeight(left) + 1) {
+        return joinLeft(left, middle, right);
+    }
+    return makeNode(left, middle, right);
+}
+
+AvlSplitResult avlSplit(AvlNode* root, int key) {
+    if(root == nullptr) {
+        return {nullptr, nullptr, nullptr};
+    }
+    AvlNode* left = root->left;
+    AvlNode* right = root->right;
+
+    if(key == root->key) {
+        root->left = nullptr;
+        root->right = nullptr;
+        root->height = 1;
+        return {left, root, right};
+    }
+    if(key < root->key) {
+        AvlSplitResult parts = avlSplit(left, key);
+        return {parts.left, parts.found, avlJoin(parts.right, root, right)};
+    }
+    AvlSplitResult parts = avlSplit(right, key);
+    return {avlJoin(left, root, parts.left), parts.found, parts.right};
+}
+
+//  removes the node with the largest key, which becomes the middle node of the join
+static AvlNode* splitLast(AvlNode* root, AvlNode*& last) {
+    if(root->right == nullptr) {
+        last = root;
+        AvlNode* rest = root->left;
+        root->left = nullptr;
+        return rest;
+    }
+    AvlNode* rest = splitLast(root->right, last);
+    return avlJoin(root->left, root, rest);
+}
+
+AvlNode* avlJoin2(AvlNode* left, AvlNode* right) {
+    if(left == nullptr) {
+        return right;
+    }
+    AvlNode* last;
+    AvlNode* rest = splitLast(left, last);
+    return avlJoin(rest, last, right);
+}
+
+AvlNode* avlEraseRange(AvlNode* root, int lo, int hi) {
+    if(lo > hi) {
+        return root;
+    }
+    AvlSplitResult below = avlSplit(root, lo);          //  below.left: keys < lo
+    AvlSplitResult above = avlSplit(below.right, hi);   //  above.left: lo < keys < hi, above.right: keys > hi
+    delete below.found;
+    delete above.found;
+    avlFreeTree(above.left);
+    return avlJoin2(below.left, above.right);
+}
+
+void avlFreeTree(AvlNode* root) {
+    if(root == nullptr) {
+        return;
+    }
+    avlFreeTree(root->left);
+    avlFreeTree(root->right);
+    delete root;
+}
+
+/*  Runs operation on both pairs of halves, the left pair on another thread if the trees are large enough and
+    forking is still allowed at this depth.
+ */
+template<typename Operation>
+static void forkJoin(Operation operation, int threadDepth, AvlNode* left1, AvlNode* left2, AvlNode*& leftResult,
+                     AvlNode* right1, AvlNode* right2, AvlNode*& rightResult) {
+    if(threadDepth > 0 && AvlNode::getHeight(left2) >= parallelHeightCutoff) {
+        auto leftHalf = std::async(std::launch::async, operation, left1, left2, threadDepth - 1);
+        rightResult = operation(right1, right2, threadDepth - 1);
+        leftResult = leftHalf.get();
+    } else {
+        leftResult = operation(left1, left2, 0);
+        rightResult = operation(right1, right2, 0);
+    }
+}
+
+static AvlNode* unionOf(AvlNode* first, AvlNode* second, int threadDepth) {
+    if(first == nullptr) {
+        return second;
+    }
+    if(second == nullptr) {
+        return first;
+    }
+    AvlNode* left2 = second->left;
+    AvlNode* right2 = second->right;
+    AvlSplitResult parts = avlSplit(first, second->key);
+    delete parts.found;     //  key is in both trees, the node of second is kept
+
+    AvlNode* left;
+    AvlNode* right;
+    forkJoin(unionOf, threadDepth, parts.left, left2, left, parts.right, right2, right);
+    return avlJoin(left, second, right);
+}
+
+static AvlNode* intersectionOf(AvlNode* first, AvlNode* second, int threadDepth) {
+    if(first == nullptr || second == nullptr) {
+        avlFreeTree(first);
+        avlFreeTree(second);
+        return nullptr;
+    }
+    AvlNode* left2 = second->left;
+    AvlNode* right2 = second->right;
+    AvlSplitResult parts = avlSplit(first, second->key);
+
+    AvlNode* left;
+    AvlNode* right;
+    forkJoin(intersectionOf, threadDepth, parts.left, left2, left, parts.right, right2, right);
+    if(parts.found != nullptr) {
+        delete parts.found;
+        return avlJoin(left, second, right);
+    }
+    delete second;
+    return avlJoin2(left, right);
+}
+
+static AvlNode* differenceOf(AvlNode* first, AvlNode* second, int threadDepth) {
+    if(first == nullptr || second == nullptr) {
+        avlFreeTree(second);
+        return first;
+    }
+    AvlNode* left2 = second->left;
+    AvlNode* right2 = second->right;
+    AvlSplitResult parts = avlSplit(first, second->key);
+    delete parts.found;
+    delete second;
+
+    AvlNode* left;
+    AvlNode* right;
+    forkJoin(differenceOf, threadDepth, parts.left, left2, left, parts.right, right2, right);
+    return avlJoin2(left, right);
+}
+
+AvlNode* avlUnion(AvlNode* first, AvlNode* second) {
+    return unionOf(first, second, initialThreadDepth());
+}
+
+AvlNode* avlIntersection(AvlNode* first, AvlNode* second) {
+    return intersectionOf(first, second, initialThreadDepth());
+}
+
+AvlNode* avlDifference(AvlNode* first, AvlNode* second) {
+    return differenceOf(first, second, initialThreadDepth());
+}
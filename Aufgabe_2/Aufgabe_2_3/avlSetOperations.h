@@ -0,0 +1,42 @@
+#ifndef AUFGABE_2_3_AVLSETOPERATIONS_H
+#define AUFGABE_2_3_AVLSETOPERATIONS_H
+
+#include "extendedAvlTree.h"
+
+/*  --
+    Join-based set operations on AVL trees (Blelloch, Ferizovic, Sun: "Just Join for Parallel Ordered Sets").
+    All functions take ownership of the trees passed in and return the root of the result; nodes that do not
+    end up in the result are deleted. No node is ever copied, every node of the result is one of the input nodes.
+
+        avlJoin(left, middle, right)    all keys of left < middle->key < all keys of right, O(|h(left) - h(right)|)
+        avlSplit(root, key)             left: keys < key, found: the detached node with key (or nullptr),
+                                        right: keys > key, O(log n)
+        avlJoin2(left, right)           join without a middle node, O(log n)
+
+    avlUnion, avlIntersection and avlDifference split the first tree at the root key of the second one and
+    recurse on both halves, which takes O(m log(n/m + 1)) work for sizes m <= n. The two recursive halves of
+    large trees run in parallel (fork-join with std::async).
+--  */
+struct AvlSplitResult {
+    AvlNode* left;
+    AvlNode* found;
+    AvlNode* right;
+};
+
+AvlNode* avlJoin(AvlNode* left, AvlNode* middle, AvlNode* right);
+AvlSplitResult avlSplit(AvlNode* root, int key);
+AvlNode* avlJoin2(AvlNode* left, AvlNode* right);
+
+AvlNode* avlUnion(AvlNode* first, AvlNode* second);
+AvlNode* avlIntersection(AvlNode* first, AvlNode* second);
+AvlNode* avlDifference(AvlNode* first, AvlNode* second);   //  keys of first that are not in second
+
+/*  Deletes every key with lo <= key <= hi: two splits detach the range as one subtree, which is freed in a single
+    pass without any rebalancing, and join2 glues the rest back together. O(log n + k) for k deleted keys,
+    instead of k deleteItem calls that each search and rebalance a path.
+ */
+AvlNode* avlEraseRange(AvlNode* root, int lo, int hi);
+
+void avlFreeTree(AvlNode* root);
+
+#endif //AUFGABE_2_3_AVLSETOPERATIONS_H
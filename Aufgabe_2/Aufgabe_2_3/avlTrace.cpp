@@ -0,0 +1,92 @@
+#include "avlTrace.h"
+#include <atomic>
+#include <mutex>
+
+static std::atomic<uint64_t> leftRotations(0);
+static std::atomic<uint64_t> rightRotations(0);
+static std::atomic<uint64_t> rotationsAtHeight[AvlTrace::maxHeight];
+
+static std::mutex ringMutex;
+static AvlTrace::Record ring[AvlTrace::capacity];
+static uint64_t nextSequence = 0;
+
+static void record(AvlTrace::Event event, int key, int height) {
+    std::lock_guard<std::mutex> lock(ringMutex);
+    ring[nextSequence % AvlTrace::capacity] = {nextSequence, event, key, height};
+    nextSequence++;
+}
+
+static const char* eventName(AvlTrace::Event event) {
+    switch(event) {
+        case AvlTrace::Event::LeftRotation: return "left rotation";
+        case AvlTrace::Event::RightRotation: return "right rotation";
+        case AvlTrace::Event::Insert: return "insert";
+        case AvlTrace::Event::Delete: return "delete";
+    }
+    return "";
+}
+
+void AvlTrace::rotation(Event event, int key, int subtreeHeight) {
+    (event == Event::LeftRotation ? leftRotations : rightRotations).fetch_add(1, std::memory_order_relaxed);
+    int bucket = subtreeHeight < maxHeight ? subtreeHeight : maxHeight - 1;
+    rotationsAtHeight[bucket].fetch_add(1, std::memory_order_relaxed);
+    record(event, key, subtreeHeight);
+}
+
+void AvlTrace::treeHeight(Event event, int key, int height) {
+    record(event, key, height);
+}
+
+uint64_t AvlTrace::getRotations(Event event) {
+    if(event == Event::LeftRotation) {
+        return leftRotations.load(std::memory_order_relaxed);
+    }
+    if(event == Event::RightRotation) {
+        return rightRotations.load(std::memory_order_relaxed);
+    }
+    return 0;
+}
+
+uint64_t AvlTrace::getRotationsAtHeight(int height) {
+    if(height < 0 || height >= maxHeight) {
+        return 0;
+    }
+    return rotationsAtHeight[height].load(std::memory_order_relaxed);
+}
+
+std::vector<AvlTrace::Record> AvlTrace::getRecords() {
+    std::lock_guard<std::mutex> lock(ringMutex);
+    uint64_t first = nextSequence > (uint64_t)capacity ? nextSequence - capacity : 0;
+    std::vector<Record> records;
+    records.reserve(nextSequence - first);
+    for(uint64_t sequence = first; sequence < nextSequence; sequence++) {
+        records.push_back(ring[sequence % capacity]);
+    }
+    return records;
+}
+
+void AvlTrace::dump(std::ostream& out) {
+    out << "Rotations: " << getRotations(Event::LeftRotation) << " left, "
+        << getRotations(Event::RightRotation) << " right\n";
+    out << "Rotations by subtree height:";
+    for(int height = 0; height < maxHeight; height++) {
+        if(getRotationsAtHeight(height) != 0) {
+            out << " " << height << ":" << getRotationsAtHeight(height);
+        }
+    }
+    out << "\n";
+    for(const Record& entry : getRecords()) {
+        out << "#" << entry.sequence << "\t" << eventName(entry.event) << "\tkey:\t" << entry.key
+            << ",\theight:\t" << entry.height << "\n";
+    }
+}
+
+void AvlTrace::reset() {
+    leftRotations = 0;
+    rightRotations = 0;
+    for(auto & count : rotationsAtHeight) {
+        count = 0;
+    }
+    std::lock_guard<std::mutex> lock(ringMutex);
+    nextSequence = 0;
+}
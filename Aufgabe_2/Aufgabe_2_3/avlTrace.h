@@ -0,0 +1,47 @@
+#ifndef AUFGABE_2_3_AVLTRACE_H
+#define AUFGABE_2_3_AVLTRACE_H
+
+#include <cstdint>
+#include <ostream>
+#include <vector>
+
+/*  --
+    Tracing of AvlNode rebalancing, switched at compile time (cmake -DAVL_TRACING=ON or -DAVL_TRACING=1).
+    All hooks are guarded by "if constexpr(avlTracing)", so with tracing off not even the call is compiled in.
+    With tracing on, AvlTrace keeps
+        - the number of left and right rotations,
+        - a histogram of the height of the subtree at which a rotation happened (1 = just above a leaf),
+        - the last `capacity` events (rotations, and the tree height after every insert/deleteItem on the
+          member functions) in a ring buffer, which dump() prints oldest first.
+    Counters are atomic and the ring buffer is guarded by a mutex, so the parallel set operations can trace too.
+--  */
+#ifndef AVL_TRACING
+#define AVL_TRACING 0
+#endif
+constexpr bool avlTracing = AVL_TRACING;
+
+class AvlTrace {
+    public:
+        enum class Event : uint8_t { LeftRotation, RightRotation, Insert, Delete };
+
+        struct Record {
+            uint64_t sequence;
+            Event event;
+            int key;
+            int height;     //  rotations: height of the rotated subtree before, insert/delete: tree height after
+        };
+
+        static const int capacity = 4096;
+        static const int maxHeight = 64;
+
+        static void rotation(Event event, int key, int subtreeHeight);
+        static void treeHeight(Event event, int key, int height);
+
+        static uint64_t getRotations(Event event);
+        static uint64_t getRotationsAtHeight(int height);
+        static std::vector<Record> getRecords();    //  oldest first
+        static void dump(std::ostream& out);
+        static void reset();
+};
+
+#endif //AUFGABE_2_3_AVLTRACE_H
@@ -0,0 +1,285 @@
+#include "compactAvlTree.h"
+#include <stdexcept>
+
+CompactAvlTree::CompactAvlTree() {
+    this->root = nil;
+    this->freeList = nil;
+    this->count = 0;
+}
+
+uint32_t CompactAvlTree::getLeft(uint32_t node) const {
+    return this->nodes[node].left & indexMask;
+}
+
+uint32_t CompactAvlTree::getRight(uint32_t node) const {
+    return this->nodes[node].right & indexMask;
+}
+
+//  the heavy bit belongs to node, it is kept when the child changes
+void CompactAvlTree::setLeft(uint32_t node, uint32_t child) {
+    this->nodes[node].left = (this->nodes[node].left & heavyBit) | child;
+}
+
+void CompactAvlTree::setRight(uint32_t node, uint32_t child) {
+    this->nodes[node].right = (this->nodes[node].right & heavyBit) | child;
+}
+
+int CompactAvlTree::getBalance(uint32_t node) const {
+    return (int)(this->nodes[node].right >> 31) - (int)(this->nodes[node].left >> 31);
+}
+
+void CompactAvlTree::setBalance(uint32_t node, int balance) {
+    Node& n = this->nodes[node];
+    n.left = (n.left & indexMask) | (balance < 0 ? heavyBit : 0);
+    n.right = (n.right & indexMask) | (balance > 0 ? heavyBit : 0);
+}
+
+uint32_t CompactAvlTree::allocateNode(int key) {
+    uint32_t node;
+    if(this->freeList != nil) {
+        node = this->freeList;
+        this->freeList = this->nodes[node].left;
+    } else {
+        if(this->nodes.size() >= nil) {
+            throw std::length_error("CompactAvlTree: more than 2^31 - 1 nodes");
+        }
+        node = (uint32_t)this->nodes.size();
+        this->nodes.push_back({});
+    }
+    this->nodes[node] = {key, nil, nil};
+    return node;
+}
+
+void CompactAvlTree::releaseNode(uint32_t node) {
+    this->nodes[node].left = this->freeList;
+    this->freeList = node;
+}
+
+//  rotations only relink, the balance factors are set by rebalance
+uint32_t CompactAvlTree::rotateLeft(uint32_t node) {
+    uint32_t rightNode = this->getRight(node);
+    this->setRight(node, this->getLeft(rightNode));
+    this->setLeft(rightNode, node);
+    return rightNode;
+}
+
+uint32_t CompactAvlTree::rotateRight(uint32_t node) {
+    uint32_t leftNode = this->getLeft(node);
+    this->setLeft(node, this->getRight(leftNode));
+    this->setRight(leftNode, node);
+    return leftNode;
+}
+
+/*  Restores a node whose balance factor would become +2 or -2 (which the two bits cannot hold) with a single
+    or double rotation and returns the new root of the subtree. heightChanged tells whether the subtree is now
+    one level lower than before the rotation; only a single rotation over a balanced child (deletion) keeps it.
+ */
+uint32_t CompactAvlTree::rebalance(uint32_t node, int balance, bool& heightChanged) {
+    if(balance > 0) {
+        uint32_t rightNode = this->getRight(node);
+        int rightBalance = this->getBalance(rightNode);
+        if(rightBalance >= 0) {
+            uint32_t newRoot = this->rotateLeft(node);
+            this->setBalance(node, rightBalance == 0 ? 1 : 0);
+            this->setBalance(newRoot, rightBalance == 0 ? -1 : 0);
+            heightChanged = rightBalance != 0;
+            return newRoot;
+        }
+        uint32_t middle = this->getLeft(rightNode);
+        int middleBalance = this->getBalance(middle);
+        this->setRight(node, this->rotateRight(rightNode));
+        uint32_t newRoot = this->rotateLeft(node);
+        this->setBalance(node, middleBalance > 0 ? -1 : 0);
+        this->setBalance(rightNode, middleBalance < 0 ? 1 : 0);
+        this->setBalance(newRoot, 0);
+        heightChanged = true;
+        return newRoot;
+    }
+
+    uint32_t leftNode = this->getLeft(node);
+    int leftBalance = this->getBalance(leftNode);
+    if(leftBalance <= 0) {
+        uint32_t newRoot = this->rotateRight(node);
+        this->setBalance(node, leftBalance == 0 ? -1 : 0);
+        this->setBalance(newRoot, leftBalance == 0 ? 1 : 0);
+        heightChanged = leftBalance != 0;
+        return newRoot;
+    }
+    uint32_t middle = this->getRight(leftNode);
+    int middleBalance = this->getBalance(middle);
+    this->setLeft(node, this->rotateLeft(leftNode));
+    uint32_t newRoot = this->rotateRight(node);
+    this->setBalance(node, middleBalance < 0 ? 1 : 0);
+    this->setBalance(leftNode, middleBalance > 0 ? -1 : 0);
+    this->setBalance(newRoot, 0);
+    heightChanged = true;
+    return newRoot;
+}
+
+bool CompactAvlTree::insert(int key) {
+    uint32_t path[maxHeight];
+    bool wentRight[maxHeight];
+    int depth = 0;
+
+    uint32_t node = this->root;
+    while(node != nil) {
+        if(key == this->nodes[node].key) {
+            return false;
+        }
+        path[depth] = node;
+        wentRight[depth] = key > this->nodes[node].key;
+        node = wentRight[depth] ? this->getRight(node) : this->getLeft(node);
+        depth++;
+    }
+
+    uint32_t newNode = this->allocateNode(key);
+    this->count++;
+    if(depth == 0) {
+        this->root = newNode;
+        return true;
+    }
+    if(wentRight[depth - 1]) {
+        this->setRight(path[depth - 1], newNode);
+    } else {
+        this->setLeft(path[depth - 1], newNode);
+    }
+
+    //  walk back up until a subtree keeps its height; after one rotation it always does
+    while(depth > 0) {
+        depth--;
+        uint32_t parent = path[depth];
+        int balance = this->getBalance(parent) + (wentRight[depth] ? 1 : -1);
+        if(balance == 0) {
+            this->setBalance(parent, 0);
+            break;
+        }
+        if(balance == 1 || balance == -1) {
+            this->setBalance(parent, balance);
+            continue;
+        }
+        bool heightChanged;
+        uint32_t subtree = this->rebalance(parent, balance, heightChanged);
+        if(depth == 0) {
+            this->root = subtree;
+        } else if(wentRight[depth - 1]) {
+            this->setRight(path[depth - 1], subtree);
+        } else {
+            this->setLeft(path[depth - 1], subtree);
+        }
+        break;
+    }
+    return true;
+}
+
+bool CompactAvlTree::deleteItem(int key) {
+    uint32_t path[maxHeight];
+    bool wentRight[maxHeight];
+    int depth = 0;
+
+    uint32_t node = this->root;
+    while(node != nil && key != this->nodes[node].key) {
+        path[depth] = node;
+        wentRight[depth] = key > this->nodes[node].key;
+        node = wentRight[depth] ? this->getRight(node) : this->getLeft(node);
+        depth++;
+    }
+    if(node == nil) {
+        return false;
+    }
+
+    //  with two children, the in-order successor's key moves up and the successor's slot is removed instead
+    if(this->getLeft(node) != nil && this->getRight(node) != nil) {
+        uint32_t target = node;
+        path[depth] = node;
+        wentRight[depth] = true;
+        depth++;
+        node = this->getRight(node);
+        while(this->getLeft(node) != nil) {
+            path[depth] = node;
+            wentRight[depth] = false;
+            depth++;
+            node = this->getLeft(node);
+        }
+        this->nodes[target].key = this->nodes[node].key;
+    }
+
+    uint32_t child = this->getLeft(node) != nil ? this->getLeft(node) : this->getRight(node);
+    if(depth == 0) {
+        this->root = child;
+    } else if(wentRight[depth - 1]) {
+        this->setRight(path[depth - 1], child);
+    } else {
+        this->setLeft(path[depth - 1], child);
+    }
+    this->releaseNode(node);
+    this->count--;
+
+    //  walk back up while the subtree got lower
+    while(depth > 0) {
+        depth--;
+        uint32_t parent = path[depth];
+        int balance = this->getBalance(parent) + (wentRight[depth] ? -1 : 1);
+        if(balance == 1 || balance == -1) {
+            this->setBalance(parent, balance);
+            break;
+        }
+        if(balance == 0) {
+            this->setBalance(parent, 0);
+            continue;
+        }
+        bool heightChanged;
+        uint32_t subtree = this->rebalance(parent, balance, heightChanged);
+        if(depth == 0) {
+            this->root = subtree;
+        } else if(wentRight[depth - 1]) {
+            this->setRight(path[depth - 1], subtree);
+        } else {
+            this->setLeft(path[depth - 1], subtree);
+        }
+        if(!heightChanged) {
+            break;
+        }
+    }
+    return true;
+}
+
+bool CompactAvlTree::contains(int key) const {
+    uint32_t node = this->root;
+    while(node != nil) {
+        const Node& n = this->nodes[node];
+        if(key == n.key) {
+            return true;
+        }
+        node = (key > n.key ? n.right : n.left) & indexMask;
+    }
+    return false;
+}
+
+size_t CompactAvlTree::size() const {
+    return this->count;
+}
+
+int CompactAvlTree::getHeight() const {
+    int height = 0;
+    uint32_t node = this->root;
+    while(node != nil) {
+        height++;
+        node = this->getBalance(node) < 0 ? this->getLeft(node) : this->getRight(node);
+    }
+    return height;
+}
+
+void CompactAvlTree::reserve(size_t count) {
+    this->nodes.reserve(count);
+}
+
+void CompactAvlTree::clear() {
+    this->nodes.clear();
+    this->root = nil;
+    this->freeList = nil;
+    this->count = 0;
+}
+
+size_t CompactAvlTree::memoryUsage() const {
+    return this->nodes.capacity() * sizeof(Node);
+}
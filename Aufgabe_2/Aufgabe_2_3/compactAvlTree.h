@@ -0,0 +1,63 @@
+#ifndef AUFGABE_2_3_COMPACTAVLTREE_H
+#define AUFGABE_2_3_COMPACTAVLTREE_H
+
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+
+/*  --
+    AVL tree for large int key sets with 12 bytes per node (AvlNode: 32 bytes with padding, plus the malloc header):
+        - all nodes live in one vector (arena) and refer to their children by 31-bit index instead of pointer,
+        - instead of the height, the balance factor (-1, 0, +1) is kept in the two high bits of the child links:
+          bit 31 of left = left subtree is higher, bit 31 of right = right subtree is higher,
+        - deleted slots are chained into a free list (through their left link) and reused by the next insert,
+        - insert and deleteItem are iterative; the path is kept on a small fixed stack.
+    Five nodes fit into a 64 byte cache line.
+--  */
+class CompactAvlTree {
+    public:
+        CompactAvlTree();
+
+        bool insert(int key);       //  false if the key was already in the tree
+        bool deleteItem(int key);   //  false if the key was not in the tree
+        bool contains(int key) const;
+
+        size_t size() const;
+        int getHeight() const;      //  follows the higher child from the root, O(log n)
+        void reserve(size_t count);
+        void clear();
+        size_t memoryUsage() const; //  bytes held by the arena
+
+    private:
+        struct Node {
+            int32_t key;
+            uint32_t left;
+            uint32_t right;
+        };
+
+        static const uint32_t heavyBit = 0x80000000u;
+        static const uint32_t indexMask = 0x7FFFFFFFu;
+        static const uint32_t nil = indexMask;      //  no child
+        static const int maxHeight = 64;            //  an AVL tree of 2^31 nodes is less than 46 levels high
+
+        std::vector<Node> nodes;
+        uint32_t root;
+        uint32_t freeList;
+        size_t count;
+
+        uint32_t getLeft(uint32_t node) const;
+        uint32_t getRight(uint32_t node) const;
+        void setLeft(uint32_t node, uint32_t child);
+        void setRight(uint32_t node, uint32_t child);
+        int getBalance(uint32_t node) const;        //  height(right) - height(left)
+        void setBalance(uint32_t node, int balance);
+
+        uint32_t allocateNode(int key);
+        void releaseNode(uint32_t node);
+
+        uint32_t rotateLeft(uint32_t node);
+        uint32_t rotateRight(uint32_t node);
+        uint32_t rebalance(uint32_t node, int balance, bool& heightChanged);
+};
+
+#endif //AUFGABE_2_3_COMPACTAVLTREE_H
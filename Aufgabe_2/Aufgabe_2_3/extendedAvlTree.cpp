@@ -1,73 +1,92 @@
 #include "extendedAvlTree.h"
+#include "avlTrace.h"
+#include <future>
+#include <thread>
 
 // helper function which returns the max of the two inputs
 int AvlNode::max(int n1, int n2) {
     return (n1> n2) ? n1 : n2;
 }
 
-// calculate height difference of a given Node by calculating difference of heights of left and right subtree
-int AvlNode::getHeightDifference() {
-    int diff;
-    if((this == nullptr)) {
-        diff = 0;
+// returns height of a given AVL Node, an empty subtree (nullptr) has height 0
+int AvlNode::getHeight(const AvlNode* node) {
+    if(node == nullptr) {
+        return 0;
     } else {
-        diff = this->left->getHeight() - this->right->getHeight();
+        return node->height;
     }
-    return diff;
 }
 
-// returns height of a given AVL Node
-int AvlNode::getHeight() {
-    if((this == nullptr)) {
+// calculate height difference of a given Node by calculating difference of heights of left and right subtree
+int AvlNode::getHeightDifference(const AvlNode* node) {
+    if(node == nullptr) {
         return 0;
     } else {
-        return this->height;
+        return getHeight(node->left) - getHeight(node->right);
     }
 }
 
-// insert a new node by recursively going to the sorted position which yields NULL
+int AvlNode::getHeightDifference() {
+    return getHeightDifference(this);
+}
+
+int AvlNode::getHeight() {
+    return this->height;
+}
+
 AvlNode* AvlNode::insert(int key) {
-    if((this == nullptr)) {
+    AvlNode* root = insert(this, key);
+    if constexpr(avlTracing) {
+        AvlTrace::treeHeight(AvlTrace::Event::Insert, key, root->height);
+    }
+    return root;
+}
+
+// insert a new node by recursively going to the sorted position which yields NULL
+AvlNode* AvlNode::insert(AvlNode* node, int key) {
+    if(node == nullptr) {
         auto* newNode = new AvlNode(key);
         return newNode;
-    } else if(key > this->key) {
-        this->right = this->right->insert(key);
-    } else if(key < this->key) {
-        this->left = this->left->insert(key);
+    } else if(key > node->key) {
+        node->right = insert(node->right, key);
+    } else if(key < node->key) {
+        node->left = insert(node->left, key);
     } else {
-        return this;
+        return node;
     }
     // update heights of all others nodes
-    this->height = 1 + this->max(this->left->getHeight(), this->right->getHeight());
+    node->height = 1 + max(getHeight(node->left), getHeight(node->right));
 
     // check if balancing is necessary
-    int diff = this->getHeightDifference();
+    int diff = getHeightDifference(node);
 
     // check which kind of balancing is necessary
     if(diff > 1) {
-        if(key > this->left->key){
-            this->left = this->left->leftRotation();
-            return this->rightRotation();
-        } else if(key < this->left->key) {
-            return this->rightRotation();
+        if(key > node->left->key){
+            node->left = node->left->leftRotation();
+            return node->rightRotation();
+        } else if(key < node->left->key) {
+            return node->rightRotation();
         }
     // check which kind of balancing is necessary
     } else if(diff < -1) {
-        if(key > this->right->key) {
-            return this->leftRotation();
-        } else if(key < this->right->key) {
-            this->right = this->right->rightRotation();
-            return this->leftRotation();
+        if(key > node->right->key) {
+            return node->leftRotation();
+        } else if(key < node->right->key) {
+            node->right = node->right->rightRotation();
+            return node->leftRotation();
         }
     }
-    return this;
+    return node;
 }
 
 
 
 // perform a left rotation (see lecture)
 AvlNode* AvlNode::leftRotation() {
-    std::cout << "Do a left rotation on node " << this->key << "\n";
+    if constexpr(avlTracing) {
+        AvlTrace::rotation(AvlTrace::Event::LeftRotation, this->key, this->height);
+    }
     AvlNode* rightNode = this->right;
     AvlNode* leftOfRightNode = rightNode->left;
 
@@ -75,8 +94,8 @@ AvlNode* AvlNode::leftRotation() {
     this->right = leftOfRightNode;
 
     //update heights
-    this->height = this->max(this->left->getHeight(), this->right->getHeight()) + 1;   
-    rightNode->height = this->max((rightNode->left->getHeight()), rightNode->right->getHeight()) + 1; 
+    this->height = max(getHeight(this->left), getHeight(this->right)) + 1;
+    rightNode->height = max(getHeight(rightNode->left), getHeight(rightNode->right)) + 1;
     return rightNode;
     
 }
@@ -84,7 +103,9 @@ AvlNode* AvlNode::leftRotation() {
 
 // perform a right rotation (see lecture)
 AvlNode* AvlNode::rightRotation() {
-    std::cout << "Do a right rotation on node " << this->key << "\n";
+    if constexpr(avlTracing) {
+        AvlTrace::rotation(AvlTrace::Event::RightRotation, this->key, this->height);
+    }
     AvlNode* leftNode = this->left;
     AvlNode* rightOfLeftNode = leftNode->right;
 
@@ -92,15 +113,22 @@ AvlNode* AvlNode::rightRotation() {
     this->left = rightOfLeftNode;
 
     //update heights
-    this->height = this->max(this->left->getHeight(), this->right->getHeight()) + 1;
-    leftNode->height = this->max(leftNode->left->getHeight(), leftNode->right->getHeight()) + 1;
+    this->height = max(getHeight(this->left), getHeight(this->right)) + 1;
+    leftNode->height = max(getHeight(leftNode->left), getHeight(leftNode->right)) + 1;
     return leftNode;
 }
 
+AvlNode* AvlNode::deleteItem(int key) {
+    AvlNode* root = deleteItem(this, key);
+    if constexpr(avlTracing) {
+        AvlTrace::treeHeight(AvlTrace::Event::Delete, key, getHeight(root));
+    }
+    return root;
+}
+
 //Could not solve the issue by my self :-( , needed some help from geeksforgeeks
 //https://www.geeksforgeeks.org/avl-tree-set-2-deletion/
-AvlNode* AvlNode::deleteItem(int key){
-    AvlNode* root = this;
+AvlNode* AvlNode::deleteItem(AvlNode* root, int key){
 
     //Check if anything there to work with
     if (root == nullptr){
@@ -108,9 +136,9 @@ AvlNode* AvlNode::deleteItem(int key){
     }
 
     if ( key < root->key ){
-        root->left = root->left->deleteItem(key);
+        root->left = deleteItem(root->left, key);
     }else if( key > root->key ){
-        root->right = root->right->deleteItem(key);
+        root->right = deleteItem(root->right, key);
     }else{
         if( (root->left == nullptr) || (root->right == nullptr) ){
 
@@ -118,11 +146,12 @@ AvlNode* AvlNode::deleteItem(int key){
             AvlNode* temp = root->left ? root->left : root->right;
 
             if (temp == nullptr){
+                delete root;
                 root = nullptr;
             }
             else{
                 *root = *temp;
-                free(temp);
+                delete temp;
             }
         }
         else{
@@ -134,37 +163,49 @@ AvlNode* AvlNode::deleteItem(int key){
             // Copy the inorder successor's data to this node
             root->key = test->key;
             // Delete the inorder successor
-            root->left = root->left->deleteItem(test->key);
+            root->left = deleteItem(root->left, test->key);
         }
     }
 
     if (root == nullptr)
         return root;
 
+    // the height of the node itself may have changed
+    root->height = 1 + max(getHeight(root->left), getHeight(root->right));
+
     // Left Left Case
-    if (root->getHeightDifference() > 1 && (root->left->getHeightDifference() >= 0)){
+    if (getHeightDifference(root) > 1 && (getHeightDifference(root->left) >= 0)){
         return root->rightRotation();
     }
 
     // Left Right Case
-    if (root->getHeightDifference() > 1 && (root->left->getHeightDifference() < 0)){
+    if (getHeightDifference(root) > 1 && (getHeightDifference(root->left) < 0)){
         root->left = root->left->leftRotation();
         return root->rightRotation();
     }
 
     // Right Right Case
-    if (root->getHeightDifference() < -1 && (root->right->getHeightDifference() <= 0)){
+    if (getHeightDifference(root) < -1 && (getHeightDifference(root->right) <= 0)){
         return root->leftRotation();
     }
 
     // Right Left Case
-    if (root->getHeightDifference() < -1 && (root->right->getHeightDifference() > 0)){
+    if (getHeightDifference(root) < -1 && (getHeightDifference(root->right) > 0)){
         root->right = root->right->rightRotation();
         return root->leftRotation();
     }
     return root;
 }
 
+// iterative search, the height of the tree bounds the number of steps
+AvlNode* AvlNode::search(AvlNode* root, int key) {
+    AvlNode* node = root;
+    while(node != nullptr && node->key != key) {
+        node = key < node->key ? node->left : node->right;
+    }
+    return node;
+}
+
 // function to print an AVL tree in pre-order: (sub)root, left (sub)tree, right (sub)tree
 std::string AvlNode::printPreorder() {
     std::stringstream output;
@@ -181,5 +222,81 @@ std::string AvlNode::printPreorder() {
     return output.str();
 }
 
+//  Below this many nodes a subtree is built on the current thread, starting a thread would cost more than it saves
+static const int parallelBuildCutoff = 1 << 14;
+
+/*  The middle node of [start, end) becomes the root, the halves left and right of it become the subtrees.
+    As long as threadDepth > 0 the left half is built on a new thread while the current thread builds the right half.
+    The halves of a perfectly balanced tree differ in height by at most one, so no rotation is ever needed.
+ */
+AvlNode* AvlNode::buildBalanced(AvlNode* nodes[], int start, int end, int threadDepth) {
+    if(start >= end) {
+        return nullptr;
+    }
+    int middle = start + (end - start) / 2;
+    AvlNode* node = nodes[middle];
+
+    if(threadDepth > 0 && end - start > parallelBuildCutoff) {
+        auto leftHalf = std::async(std::launch::async, [=]() { return buildBalanced(nodes, start, middle, threadDepth - 1); });
+        node->right = buildBalanced(nodes, middle + 1, end, threadDepth - 1);
+        node->left = leftHalf.get();
+    } else {
+        node->left = buildBalanced(nodes, start, middle, 0);
+        node->right = buildBalanced(nodes, middle + 1, end, 0);
+    }
+    node->height = 1 + max(getHeight(node->left), getHeight(node->right));
+    return node;
+}
 
-  
+AvlNode* AvlNode::buildBalanced(AvlNode* nodes[], int size) {
+    //  every level of threads doubles the number of threads: depth = log2(number of cores)
+    int threadDepth = 0;
+    for(unsigned int cores = std::thread::hardware_concurrency(); cores > 1; cores /= 2) {
+        threadDepth++;
+    }
+    return buildBalanced(nodes, 0, size, threadDepth);
+}
+
+AvlNode* AvlNode::buildFromSorted(const int keys[], int size) {
+    std::vector<AvlNode*> nodes;
+    nodes.reserve(size);
+    for(int i = 0; i < size; i++) {
+        if(nodes.empty() || nodes.back()->key != keys[i]) {
+            nodes.push_back(new AvlNode(keys[i]));
+        }
+    }
+    return buildBalanced(nodes.data(), (int)nodes.size());
+}
+
+AvlNode* AvlNode::insertBatch(AvlNode* root, const int keys[], int size) {
+    //  collect the existing nodes in-order
+    std::vector<AvlNode*> inorder;
+    std::vector<AvlNode*> stack;
+    AvlNode* node = root;
+    while(node != nullptr || !stack.empty()) {
+        while(node != nullptr) {
+            stack.push_back(node);
+            node = node->left;
+        }
+        node = stack.back();
+        stack.pop_back();
+        inorder.push_back(node);
+        node = node->right;
+    }
+
+    //  merge step of merge sort; keys already in the tree reuse their node, new keys get a new node
+    std::vector<AvlNode*> merged;
+    merged.reserve(inorder.size() + size);
+    int i = 0;
+    int j = 0;
+    while(i < (int)inorder.size() || j < size) {
+        if(j == size || (i < (int)inorder.size() && inorder[i]->key <= keys[j])) {
+            merged.push_back(inorder[i++]);
+        } else if(!merged.empty() && merged.back()->key == keys[j]) {
+            j++;    //  key is already in the tree or twice in the batch
+        } else {
+            merged.push_back(new AvlNode(keys[j++]));
+        }
+    }
+    return buildBalanced(merged.data(), (int)merged.size());
+}
@@ -1,6 +1,10 @@
+#ifndef AUFGABE_2_3_EXTENDEDAVLTREE_H
+#define AUFGABE_2_3_EXTENDEDAVLTREE_H
+
 #include <string>
 #include <iostream>
 #include <sstream>
+#include <vector>
 
 class AvlNode {
     public:
@@ -20,14 +24,39 @@ class AvlNode {
         int getHeightDifference();
         int getHeight();
 
+        /*  --
+            The static versions accept an empty tree (nullptr) and are used for the recursion; the member versions
+            must only be called on an existing node. (Calling members through nullptr is undefined behaviour and
+            is optimised away at -O2.)
+        --  */
+        static int getHeightDifference(const AvlNode* node);
+        static int getHeight(const AvlNode* node);
+
         AvlNode* insert(int key);
         AvlNode* deleteItem(int key);
+        static AvlNode* insert(AvlNode* node, int key);
+        static AvlNode* deleteItem(AvlNode* root, int key);
+        static AvlNode* search(AvlNode* root, int key);     //  nullptr if key is not in the tree
         AvlNode* leftRotation();
         AvlNode* rightRotation();
 
         std::string printPreorder();
 
+        /*  --
+            Bulk construction from keys sorted ascending (duplicates are skipped like in insert):
+            buildFromSorted builds a perfectly balanced tree in O(n), the two halves of the upper levels are
+            built on separate threads. insertBatch merges a sorted batch with the in-order sequence of the tree
+            rooted at root, reuses its nodes and returns the root of the rebuilt tree, O(n + k).
+        --  */
+        static AvlNode* buildFromSorted(const int keys[], int size);
+        static AvlNode* insertBatch(AvlNode* root, const int keys[], int size);
+
+    private:
+        static AvlNode* buildBalanced(AvlNode* nodes[], int start, int end, int threadDepth);
+        static AvlNode* buildBalanced(AvlNode* nodes[], int size);
+
 
 
 };
 
+#endif //AUFGABE_2_3_EXTENDEDAVLTREE_H
@@ -1,5 +1,15 @@
 #include "extendedAvlTree.h"
+#include "persistentAvlTree.h"
+#include "treeFile.h"
+#include "avlMap.h"
+#include "avlSetOperations.h"
+#include "compactAvlTree.h"
+#include "avlTrace.h"
 #include <iostream>
+#include <vector>
+#include <thread>
+#include <atomic>
+#include <chrono>
 
 int main() {
     auto* root = new AvlNode(10);
@@ -34,5 +44,130 @@ int main() {
     //Print out
     std::cout << root->printPreorder();
     std::cout << "Perfectly balanced! As all things should be!" << std::endl;
+    if constexpr(avlTracing) {
+        AvlTrace::dump(std::cout);
+    }
+
+    //  Bulk build from one million sorted keys and merge of a sorted batch
+    std::vector<int> keys(1000000);
+    for(int i = 0; i < (int)keys.size(); i++) {
+        keys[i] = 2 * i;
+    }
+    AvlNode* bulkRoot = AvlNode::buildFromSorted(keys.data(), (int)keys.size());
+    std::cout << "Bulk built " << keys.size() << " keys, height " << bulkRoot->getHeight() << std::endl;
+
+    std::vector<int> batch(250000);
+    for(int i = 0; i < (int)batch.size(); i++) {
+        batch[i] = 8 * i + 1;
+    }
+    bulkRoot = AvlNode::insertBatch(bulkRoot, batch.data(), (int)batch.size());
+    std::cout << "Inserted batch of " << batch.size() << " keys, height " << bulkRoot->getHeight() << std::endl;
+
+    //  Save the tree, use the mapped file as read-only index and rebuild the pointer tree from it
+    saveTree(bulkRoot, "bulkTree.avl");
+    MappedAvlIndex mappedIndex("bulkTree.avl");
+    std::cout << "Mapped index with " << mappedIndex.size() << " keys, contains 17: " << mappedIndex.contains(17)
+              << ", contains 19: " << mappedIndex.contains(19) << std::endl;
+    AvlNode* reloaded = loadTree("bulkTree.avl");
+    std::cout << "Reloaded tree, height " << reloaded->getHeight() << std::endl;
+
+    //  Set operations on whole trees: merge a small delta into the big tree, intersect and diff two big trees
+    std::vector<int> delta = {3, 5, 9, 1000001, 2500000};
+    bulkRoot = avlUnion(bulkRoot, AvlNode::buildFromSorted(delta.data(), (int)delta.size()));
+    std::cout << "Union with delta, height " << bulkRoot->getHeight() << std::endl;
+    AvlNode* oddKeys = AvlNode::buildFromSorted(batch.data(), (int)batch.size());
+    AvlNode* common = avlIntersection(loadTree("bulkTree.avl"), oddKeys);
+    std::cout << "Intersection with the batch, height " << common->getHeight() << std::endl;
+    reloaded = avlDifference(reloaded, common);
+    std::cout << "Difference without the batch, height " << reloaded->getHeight() << std::endl;
+    reloaded = avlEraseRange(reloaded, 0, 999999);
+    std::cout << "Erased all keys below 1000000, " << (AvlNode::search(reloaded, 999998) == nullptr ? "gone" : "still there")
+              << ", height " << reloaded->getHeight() << std::endl;
+    avlFreeTree(reloaded);
+
+    //  The same million keys in the compact arena tree
+    CompactAvlTree compactTree;
+    compactTree.reserve(keys.size());
+    for(int key : keys) {
+        compactTree.insert(key);
+    }
+    for(int i = 0; i < (int)keys.size(); i += 4) {
+        compactTree.deleteItem(keys[i]);
+    }
+    std::cout << "Compact tree with " << compactTree.size() << " keys, height " << compactTree.getHeight() << ", "
+              << (double)compactTree.memoryUsage() / keys.size() << " bytes per slot (AvlNode: " << sizeof(AvlNode)
+              << " bytes plus allocation overhead)" << std::endl;
+
+    //  Generic AVL map with a payload per key, ordered iteration and range queries
+    struct Stock {
+        std::string bezeichnung;
+        int menge;
+    };
+    AvlMap<int, Stock> lager;
+    lager.insert({4711, {"Schwert", 3}});
+    lager.insert({815, {"Trank", 12}});
+    lager.insert({1337, {"Pilz", 40}});
+    lager.insert({42, {"Salz", 7}});
+    lager[2000] = {"Pelz", 1};
+    lager.erase(815);
+    std::cout << "AvlMap in order:";
+    for(auto & entry : lager) {
+        std::cout << " " << entry.first << "=" << entry.second.bezeichnung;
+    }
+    std::cout << std::endl << "Serial numbers from 1000 to 4711:";
+    for(auto it = lager.lower_bound(1000); it != lager.upper_bound(4711); ++it) {
+        std::cout << " " << it->first << " (" << it->second.menge << ")";
+    }
+    std::cout << std::endl;
+
+    //  Augmented map: stock per price, k-th cheapest price, rank of a price and stock in a price range
+    AvlMap<int, int, std::less<int>, std::allocator<std::pair<const int, int>>, SubtreeAggregate<int>> stockByPrice;
+    for(int price = 100; price <= 1000; price += 50) {
+        stockByPrice.insert({price, price / 100});
+    }
+    stockByPrice.insert_or_assign(500, 20);
+    stockByPrice.erase(150);
+    std::cout << "3rd cheapest price: " << stockByPrice.select(2)->first << ", rank of 700: "
+              << stockByPrice.rank(700) << ", stock from 300 to 600: " << stockByPrice.rangeSum(300, 600)
+              << ", largest stock: " << stockByPrice.aggregate().max << std::endl;
+
+    //  Path-copying tree: one writer keeps updating while 1, 2 and 4 readers search without locks
+    PersistentAvlTree priceTree;
+    for(int i = 0; i < 100000; i++) {
+        priceTree.insert(i);
+    }
+    for(int readerCount = 1; readerCount <= 4; readerCount *= 2) {
+        std::atomic<bool> stop(false);
+        std::atomic<long> lookups(0);
+        std::vector<std::thread> readers;
+        for(int r = 0; r < readerCount; r++) {
+            readers.emplace_back([&priceTree, &stop, &lookups, r]() {
+                long count = 0;
+                unsigned int key = r;
+                while(!stop.load()) {
+                    auto snapshot = priceTree.snapshot();
+                    for(int i = 0; i < 64; i++) {
+                        key = key * 1103515245 + 12345;
+                        snapshot.contains((int)(key % 200000));
+                    }
+                    count += 64;
+                }
+                lookups += count;
+            });
+        }
+        std::thread writer([&priceTree, &stop]() {
+            for(int i = 0; !stop.load(); i++) {
+                priceTree.insert(100000 + i % 100000);
+                priceTree.deleteItem(100000 + (i + 50000) % 100000);
+            }
+        });
+        std::this_thread::sleep_for(std::chrono::milliseconds(300));
+        stop = true;
+        writer.join();
+        for(auto & reader : readers) {
+            reader.join();
+        }
+        std::cout << readerCount << " reader(s) during updates: " << lookups.load() / 300 << " lookups/ms" << std::endl;
+    }
     return 0;
 }
@@ -0,0 +1,241 @@
+#include "persistentAvlTree.h"
+#include <thread>
+#include <algorithm>
+
+PersistentAvlTree::PersistentAvlTree() {
+    this->root.store(nullptr);
+    this->globalEpoch.store(1);     //  epoch 0 marks a free reader slot
+}
+
+PersistentAvlTree::~PersistentAvlTree() {
+    freeTree(this->root.load());
+    for(auto & batch : this->retired) {
+        for(const Node* node : batch.nodes) {
+            delete node;
+        }
+    }
+}
+
+int PersistentAvlTree::getHeight(const Node* node) {
+    return node == nullptr ? 0 : node->height;
+}
+
+const PersistentAvlTree::Node* PersistentAvlTree::makeNode(int key, const Node* left, const Node* right) {
+    int height = 1 + std::max(getHeight(left), getHeight(right));
+    return new Node{key, left, right, height};
+}
+
+/*  Builds the node (key, left, right) and restores the AVL property with a single or double rotation.
+    Rotations cannot change published nodes, so the nodes they would change are rebuilt and the consumed ones
+    are recorded as replaced. A consumed node may also be a copy made by this update; it is never published,
+    retiring it only delays its release.
+ */
+const PersistentAvlTree::Node* PersistentAvlTree::balance(int key, const Node* left, const Node* right) {
+    int diff = getHeight(left) - getHeight(right);
+
+    if(diff > 1) {
+        this->replaced.push_back(left);
+        if(getHeight(left->left) >= getHeight(left->right)) {   //  Left Left Case: right rotation
+            return makeNode(left->key, left->left, makeNode(key, left->right, right));
+        }
+        const Node* leftRight = left->right;                    //  Left Right Case: left-right rotation
+        this->replaced.push_back(leftRight);
+        return makeNode(leftRight->key, makeNode(left->key, left->left, leftRight->left),
+                        makeNode(key, leftRight->right, right));
+    }
+    if(diff < -1) {
+        this->replaced.push_back(right);
+        if(getHeight(right->right) >= getHeight(right->left)) { //  Right Right Case: left rotation
+            return makeNode(right->key, makeNode(key, left, right->left), right->right);
+        }
+        const Node* rightLeft = right->left;                    //  Right Left Case: right-left rotation
+        this->replaced.push_back(rightLeft);
+        return makeNode(rightLeft->key, makeNode(key, left, rightLeft->left),
+                        makeNode(right->key, rightLeft->right, right->right));
+    }
+    return makeNode(key, left, right);
+}
+
+const PersistentAvlTree::Node* PersistentAvlTree::insert(const Node* node, int key) {
+    if(node == nullptr) {
+        return makeNode(key, nullptr, nullptr);
+    }
+    if(key < node->key) {
+        const Node* left = this->insert(node->left, key);
+        if(left == node->left) {
+            return node;    //  key already in the tree, nothing was copied
+        }
+        this->replaced.push_back(node);
+        return this->balance(node->key, left, node->right);
+    }
+    if(key > node->key) {
+        const Node* right = this->insert(node->right, key);
+        if(right == node->right) {
+            return node;
+        }
+        this->replaced.push_back(node);
+        return this->balance(node->key, node->left, right);
+    }
+    return node;
+}
+
+const PersistentAvlTree::Node* PersistentAvlTree::deleteMin(const Node* node, int& minKey) {
+    this->replaced.push_back(node);
+    if(node->left == nullptr) {
+        minKey = node->key;
+        return node->right;
+    }
+    const Node* left = this->deleteMin(node->left, minKey);
+    return this->balance(node->key, left, node->right);
+}
+
+const PersistentAvlTree::Node* PersistentAvlTree::deleteItem(const Node* node, int key) {
+    if(node == nullptr) {
+        return nullptr;
+    }
+    if(key < node->key) {
+        const Node* left = this->deleteItem(node->left, key);
+        if(left == node->left) {
+            return node;    //  key not in the tree, nothing was copied
+        }
+        this->replaced.push_back(node);
+        return this->balance(node->key, left, node->right);
+    }
+    if(key > node->key) {
+        const Node* right = this->deleteItem(node->right, key);
+        if(right == node->right) {
+            return node;
+        }
+        this->replaced.push_back(node);
+        return this->balance(node->key, node->left, right);
+    }
+
+    this->replaced.push_back(node);
+    if(node->left == nullptr) {
+        return node->right;
+    }
+    if(node->right == nullptr) {
+        return node->left;
+    }
+    // the inorder successor takes the place of the deleted node
+    int successor;
+    const Node* right = this->deleteMin(node->right, successor);
+    return this->balance(successor, node->left, right);
+}
+
+void PersistentAvlTree::insert(int key) {
+    std::lock_guard<std::mutex> lock(this->writerLock);
+    const Node* oldRoot = this->root.load();
+    const Node* newRoot = this->insert(oldRoot, key);
+    if(newRoot != oldRoot) {
+        this->publish(newRoot);
+    }
+}
+
+void PersistentAvlTree::deleteItem(int key) {
+    std::lock_guard<std::mutex> lock(this->writerLock);
+    const Node* oldRoot = this->root.load();
+    const Node* newRoot = this->deleteItem(oldRoot, key);
+    if(newRoot != oldRoot) {
+        this->publish(newRoot);
+    }
+}
+
+/*  Publishing order matters: the new root is stored before the epoch is advanced. A reader that pins the new
+    epoch therefore loads the new root (or a later one) and can never reach the nodes retired here.
+ */
+void PersistentAvlTree::publish(const Node* newRoot) {
+    this->root.store(newRoot);
+    uint64_t epoch = this->globalEpoch.fetch_add(1);
+    this->retired.push_back({epoch, std::move(this->replaced)});
+    this->replaced.clear();
+    this->reclaim();
+}
+
+//  frees every batch that was retired before the oldest epoch still pinned by a reader
+void PersistentAvlTree::reclaim() {
+    uint64_t oldestPinned = this->globalEpoch.load();
+    for(auto & reader : this->readers) {
+        uint64_t epoch = reader.epoch.load();
+        if(epoch != 0 && epoch < oldestPinned) {
+            oldestPinned = epoch;
+        }
+    }
+
+    while(!this->retired.empty() && this->retired.front().epoch < oldestPinned) {
+        for(const Node* node : this->retired.front().nodes) {
+            delete node;
+        }
+        this->retired.pop_front();
+    }
+}
+
+void PersistentAvlTree::freeTree(const Node* node) {
+    if(node == nullptr) {
+        return;
+    }
+    freeTree(node->left);
+    freeTree(node->right);
+    delete node;
+}
+
+/*  A reader claims a free slot and pins the current epoch in the same step, then loads the root.
+    The thread-local hint makes a thread retry the slot it used last time first.
+ */
+PersistentAvlTree::Snapshot PersistentAvlTree::snapshot() {
+    static thread_local int hint = 0;
+    while(true) {
+        for(int i = 0; i < maxReaders; i++) {
+            int index = (hint + i) % maxReaders;
+            uint64_t expected = 0;
+            if(this->readers[index].epoch.compare_exchange_strong(expected, this->globalEpoch.load())) {
+                hint = index;
+                return Snapshot(&this->readers[index].epoch, this->root.load());
+            }
+        }
+        std::this_thread::yield();  //  all slots taken, wait for a reader to finish
+    }
+}
+
+bool PersistentAvlTree::contains(int key) {
+    return this->snapshot().contains(key);
+}
+
+PersistentAvlTree::Snapshot::Snapshot(std::atomic<uint64_t>* slot, const Node* root) {
+    this->slot = slot;
+    this->root = root;
+}
+
+PersistentAvlTree::Snapshot::Snapshot(Snapshot&& other) noexcept {
+    this->slot = other.slot;
+    this->root = other.root;
+    other.slot = nullptr;
+}
+
+PersistentAvlTree::Snapshot::~Snapshot() {
+    if(this->slot != nullptr) {
+        this->slot->store(0);
+    }
+}
+
+bool PersistentAvlTree::Snapshot::contains(int key) const {
+    const Node* node = this->root;
+    while(node != nullptr) {
+        if(key < node->key) {
+            node = node->left;
+        } else if(key > node->key) {
+            node = node->right;
+        } else {
+            return true;
+        }
+    }
+    return false;
+}
+
+int PersistentAvlTree::Snapshot::getHeight() const {
+    return PersistentAvlTree::getHeight(this->root);
+}
+
+const PersistentAvlTree::Node* PersistentAvlTree::Snapshot::getRoot() const {
+    return this->root;
+}
@@ -0,0 +1,93 @@
+#ifndef AUFGABE_2_3_PERSISTENTAVLTREE_H
+#define AUFGABE_2_3_PERSISTENTAVLTREE_H
+
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+#include <deque>
+
+/*  --
+    AVL tree with path copying for concurrent readers:
+        - a node is never changed after it was published; insert and deleteItem copy the nodes on the
+          root-to-leaf path (and the few nodes touched by rotations) and publish a new root atomically,
+          all untouched subtrees are shared between the old and the new version,
+        - readers take a Snapshot, which pins the current epoch and loads the root; they traverse without
+          any lock and always see one consistent version,
+        - replaced nodes are retired with the epoch of the update and freed once no reader pinned that epoch
+          or an older one any more (epoch-based reclamation).
+    Updates are serialised by a mutex (single writer), reads never block.
+--  */
+class PersistentAvlTree {
+    public:
+        struct Node {
+            const int key;
+            const Node* const left;
+            const Node* const right;
+            const int height;
+        };
+
+        class Snapshot {
+            public:
+                Snapshot(Snapshot&& other) noexcept;
+                Snapshot(const Snapshot&) = delete;
+                Snapshot& operator=(const Snapshot&) = delete;
+                ~Snapshot();
+
+                bool contains(int key) const;
+                int getHeight() const;
+                const Node* getRoot() const;
+
+            private:
+                friend class PersistentAvlTree;
+                Snapshot(std::atomic<uint64_t>* slot, const Node* root);
+
+                std::atomic<uint64_t>* slot;    //  reader slot that pins the epoch, released in the destructor
+                const Node* root;
+        };
+
+        PersistentAvlTree();
+        PersistentAvlTree(const PersistentAvlTree&) = delete;
+        PersistentAvlTree& operator=(const PersistentAvlTree&) = delete;
+        ~PersistentAvlTree();   //  no Snapshot may outlive the tree
+
+        void insert(int key);
+        void deleteItem(int key);
+
+        //  Snapshots should be short lived: as long as one exists, no version published after it can be freed
+        Snapshot snapshot();
+        bool contains(int key);
+
+    private:
+        static const int maxReaders = 128;
+
+        struct alignas(64) ReaderSlot {
+            std::atomic<uint64_t> epoch{0};     //  0: slot is free, otherwise the epoch the reader pinned
+        };
+
+        struct RetiredBatch {
+            uint64_t epoch;
+            std::vector<const Node*> nodes;
+        };
+
+        std::atomic<const Node*> root;
+        std::atomic<uint64_t> globalEpoch;
+        ReaderSlot readers[maxReaders];
+
+        std::mutex writerLock;
+        std::deque<RetiredBatch> retired;
+        std::vector<const Node*> replaced;      //  nodes replaced by the running update
+
+        static int getHeight(const Node* node);
+        const Node* makeNode(int key, const Node* left, const Node* right);
+        const Node* balance(int key, const Node* left, const Node* right);
+        const Node* insert(const Node* node, int key);
+        const Node* deleteItem(const Node* node, int key);
+        const Node* deleteMin(const Node* node, int& minKey);
+
+        void publish(const Node* newRoot);
+        void reclaim();
+        static void freeTree(const Node* node);
+};
+
+#endif //AUFGABE_2_3_PERSISTENTAVLTREE_H
@@ -0,0 +1,217 @@
+#include "treeFile.h"
+#include <stdexcept>
+#include <cstring>
+#include <fstream>
+#include <vector>
+#include <algorithm>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+static const char treeFileMagic[4] = {'A', 'V', 'L', '1'};
+
+MappedFile::MappedFile(const std::string& path) {
+    int fd = open(path.c_str(), O_RDONLY);
+    if(fd == -1) {
+        throw std::runtime_error("Could not open " + path);
+    }
+    struct stat info{};
+    if(fstat(fd, &info) == -1 || info.st_size == 0) {
+        close(fd);
+        throw std::runtime_error("Could not read " + path);
+    }
+    void* mapping = mmap(nullptr, info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);  //  the mapping stays valid after closing the descriptor
+    if(mapping == MAP_FAILED) {
+        throw std::runtime_error("Could not map " + path);
+    }
+    this->data = static_cast<const unsigned char*>(mapping);
+    this->size = info.st_size;
+}
+
+MappedFile::~MappedFile() {
+    munmap(const_cast<unsigned char*>(this->data), this->size);
+}
+
+const unsigned char* MappedFile::getData() const {
+    return this->data;
+}
+
+size_t MappedFile::getSize() const {
+    return this->size;
+}
+
+//  checks header and file size, returns the number of nodes and the start of the keys and structure bits
+static uint64_t readTreeFile(const MappedFile& file, const int32_t*& keys, const unsigned char*& structure) {
+    if(file.getSize() < sizeof(TreeFileHeader)) {
+        throw std::runtime_error("Tree file too short");
+    }
+    TreeFileHeader header{};
+    std::memcpy(&header, file.getData(), sizeof(header));
+    if(std::memcmp(header.magic, treeFileMagic, sizeof(treeFileMagic)) != 0 || header.recordSize != sizeof(int32_t)) {
+        throw std::runtime_error("Not an AVL tree file");
+    }
+    //  bound nodeCount by the bytes after the header first, so that the size below can not wrap around
+    if(header.nodeCount > (file.getSize() - sizeof(TreeFileHeader)) / sizeof(int32_t)) {
+        throw std::runtime_error("Tree file has the wrong size");
+    }
+    uint64_t expectedSize = sizeof(TreeFileHeader) + header.nodeCount * sizeof(int32_t) + (header.nodeCount + 3) / 4;
+    if(file.getSize() != expectedSize) {
+        throw std::runtime_error("Tree file has the wrong size");
+    }
+    keys = reinterpret_cast<const int32_t*>(file.getData() + sizeof(TreeFileHeader));
+    structure = file.getData() + sizeof(TreeFileHeader) + header.nodeCount * sizeof(int32_t);
+    return header.nodeCount;
+}
+
+void saveTree(const AvlNode* root, const std::string& path) {
+    std::vector<int32_t> keys;
+    std::vector<unsigned char> structure;
+
+    //  structure bits in preorder
+    std::vector<const AvlNode*> stack;
+    if(root != nullptr) {
+        stack.push_back(root);
+    }
+    uint64_t count = 0;
+    while(!stack.empty()) {
+        const AvlNode* node = stack.back();
+        stack.pop_back();
+        unsigned char bits = (node->left != nullptr ? 1 : 0) | (node->right != nullptr ? 2 : 0);
+        if(count % 4 == 0) {
+            structure.push_back(0);
+        }
+        structure.back() |= bits << (2 * (count % 4));
+        count++;
+
+        if(node->right != nullptr) {
+            stack.push_back(node->right);
+        }
+        if(node->left != nullptr) {
+            stack.push_back(node->left);
+        }
+    }
+
+    //  keys in-order
+    keys.reserve(count);
+    const AvlNode* node = root;
+    while(node != nullptr || !stack.empty()) {
+        while(node != nullptr) {
+            stack.push_back(node);
+            node = node->left;
+        }
+        node = stack.back();
+        stack.pop_back();
+        keys.push_back(node->key);
+        node = node->right;
+    }
+
+    TreeFileHeader header{};
+    std::memcpy(header.magic, treeFileMagic, sizeof(treeFileMagic));
+    header.recordSize = sizeof(int32_t);
+    header.nodeCount = count;
+
+    std::ofstream out(path, std::ios::binary | std::ios::trunc);
+    out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    out.write(reinterpret_cast<const char*>(keys.data()), (std::streamsize)(keys.size() * sizeof(int32_t)));
+    out.write(reinterpret_cast<const char*>(structure.data()), (std::streamsize)structure.size());
+    if(!out) {
+        throw std::runtime_error("Could not write " + path);
+    }
+}
+
+/*  One linear pass over the file: the structure bits are consumed in preorder, the keys in in-order.
+    This is the recursive build(){ left = build(); node = next key; right = build(); height = ... } with an
+    explicit stack, so even a very large tree does not depend on the size of the call stack.
+ */
+AvlNode* loadTree(const std::string& path) {
+    MappedFile file(path);
+    const int32_t* keys;
+    const unsigned char* structure;
+    uint64_t count = readTreeFile(file, keys, structure);
+
+    if(count == 0) {
+        return nullptr;
+    }
+
+    struct Frame {
+        unsigned char bits;
+        int stage;          //  0: nothing built yet, 1: left subtree built, 2: right subtree built
+        AvlNode* node;
+    };
+    uint64_t nextBits = 0;
+    uint64_t nextKey = 0;
+    //  the bits come from the file: every node has its own 2 bits and key, a file whose bits describe more or
+    //  fewer nodes than nodeCount is rejected before anything outside the mapping is read
+    std::vector<AvlNode*> built;
+    auto fail = [&built]() {
+        for(AvlNode* node : built) {
+            delete node;
+        }
+        throw std::runtime_error("Tree file structure does not match its node count");
+    };
+    auto readBits = [&]() {
+        if(nextBits >= count) {
+            fail();
+        }
+        unsigned char bits = (structure[nextBits / 4] >> (2 * (nextBits % 4))) & 3;
+        nextBits++;
+        return bits;
+    };
+
+    std::vector<Frame> stack;
+    stack.push_back({readBits(), 0, nullptr});
+    AvlNode* result = nullptr;  //  root of the subtree finished last
+    while(!stack.empty()) {
+        Frame& frame = stack.back();
+        if(frame.stage == 0) {
+            frame.stage = 1;
+            if(frame.bits & 1) {
+                stack.push_back({readBits(), 0, nullptr});
+                continue;
+            }
+            result = nullptr;
+        }
+        if(frame.stage == 1) {
+            if(nextKey >= count) {
+                fail();
+            }
+            frame.node = new AvlNode(keys[nextKey++]);
+            built.push_back(frame.node);
+            frame.node->left = result;
+            frame.stage = 2;
+            if(frame.bits & 2) {
+                stack.push_back({readBits(), 0, nullptr});
+                continue;
+            }
+            result = nullptr;
+        }
+        AvlNode* node = frame.node;
+        node->right = result;
+        node->height = 1 + AvlNode::max(AvlNode::getHeight(node->left), AvlNode::getHeight(node->right));
+        result = node;
+        stack.pop_back();
+    }
+    if(nextKey != count) {
+        fail();
+    }
+    return result;
+}
+
+MappedAvlIndex::MappedAvlIndex(const std::string& path) : file(path) {
+    const unsigned char* structure;
+    this->count = readTreeFile(this->file, this->keys, structure);
+}
+
+size_t MappedAvlIndex::size() const {
+    return this->count;
+}
+
+int MappedAvlIndex::operator[](size_t index) const {
+    return this->keys[index];
+}
+
+bool MappedAvlIndex::contains(int key) const {
+    return std::binary_search(this->keys, this->keys + this->count, key);
+}
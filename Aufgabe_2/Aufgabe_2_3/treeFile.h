@@ -0,0 +1,57 @@
+#ifndef AUFGABE_2_3_TREEFILE_H
+#define AUFGABE_2_3_TREEFILE_H
+
+#include <cstdint>
+#include <cstddef>
+#include <string>
+#include "extendedAvlTree.h"
+
+/*  --
+    Tree file layout (native byte order):
+        header      TreeFileHeader
+        keys        one int32_t per node in in-order, i.e. sorted ascending
+        structure   2 bits per node in preorder: bit 0 = node has a left child, bit 1 = node has a right child
+    Because the keys are sorted, the mapped file can be searched directly as a read-only index.
+    The structure bits rebuild exactly the saved shape (heights included) in one linear pass, without rotations.
+--  */
+struct TreeFileHeader {
+    char magic[4];
+    uint32_t recordSize;
+    uint64_t nodeCount;
+};
+
+//  Read-only memory mapping of a whole file, unmapped in the destructor
+class MappedFile {
+    public:
+        explicit MappedFile(const std::string& path);
+        MappedFile(const MappedFile&) = delete;
+        MappedFile& operator=(const MappedFile&) = delete;
+        ~MappedFile();
+
+        const unsigned char* getData() const;
+        size_t getSize() const;
+
+    private:
+        const unsigned char* data;
+        size_t size;
+};
+
+//  The mapped keys used as a sorted array, lookups by binary search without building any tree
+class MappedAvlIndex {
+    public:
+        explicit MappedAvlIndex(const std::string& path);
+
+        size_t size() const;
+        int operator[](size_t index) const;
+        bool contains(int key) const;
+
+    private:
+        MappedFile file;
+        const int32_t* keys;
+        size_t count;
+};
+
+void saveTree(const AvlNode* root, const std::string& path);    //  throws std::runtime_error
+AvlNode* loadTree(const std::string& path);                     //  throws std::runtime_error, returns the new root
+
+#endif //AUFGABE_2_3_TREEFILE_H
@@ -5,6 +5,7 @@
 Graph::Graph(const std::vector<std::string>& vertices, const std::vector<Edge>& edges) {
     this->vertices = vertices;                                                                  //  definition of this->vertex through parameter vertices (type: std::vector<std::string>)
     this->adjacencyMatrix.resize(vertices.size(), std::vector<int>(this->vertices.size()));     //  creation of an NxN Matrix, based on the size of vertices
+    this->rebuildVertexIds();                                                                   //  every name is hashed once, the edges below only look them up
 
     for(const auto & edge : edges) {
         insertEdge(edge);                   //  edges are added one by one, utilizing the insertEdge()-Function
@@ -21,6 +22,7 @@ void Graph::insertVertex(const std::string& vertex) {
         std::cerr << "Vertex already in Graph!\n";  /*  Calls this->resolveVertex to check if a given vertex is already in the Graph. Returns with an error, if this is the case.   */
         return;                                     /*  --  */
     }
+    this->vertexIds.emplace(vertex, (int)this->vertices.size());    //  the new vertex gets the next free index
     this->vertices.push_back(vertex);               //  adds a vertetx via the push_back function provided by std::vector
     this->adjacencyMatrix.resize(this->vertices.size(), std::vector<int>(this->vertices.size()));   //  resizes the adjacencyMatrix to the new size
     for(int i = 0; i < (this->vertices.size()); i++) {        /*  --  */
@@ -34,15 +36,19 @@ Function to delete a vertex from the Graph;
     - returns void
 /   --  */
 void Graph::deleteVertex(const std::string& vertex) {
-    int index = this->resolveVertex(vertex);
-    if(index == -1) {                               /*  --  */
-        std::cerr << "Vertex not found\n";          /*  Calls this->resolveVertex to check if a given vertex is already in the Graph. Returns with an error, if this is the case.   */
+    this->deleteVertex(this->resolveVertex(vertex));
+}
+
+void Graph::deleteVertex(int index) {
+    if(!this->validVertex(index)) {                 /*  --  */
+        std::cerr << "Vertex not found\n";          /*  Calls this->validVertex to check if a given vertex is in the Graph. Returns with an error, if this is not the case.   */
         return;                                     /*  --  */
     }
     this->vertices.erase(this->vertices.begin() + index);   //  erases the vertex at position "index" from this->vertices
+    this->rebuildVertexIds();                               //  all following vertices moved down by one
 
     this->adjacencyMatrix.erase(this->adjacencyMatrix.begin() + index);             //  erases the entries from the adjacencyMatrix at "column" position "index"
-    for(int i = 0; i < (this->adjacencyMatrix[0].size()); i ++) {                     /*  --  */
+    for(int i = 0; i < (this->adjacencyMatrix.size()); i ++) {                        /*  --  */
         this->adjacencyMatrix[i].erase(this->adjacencyMatrix[i].begin() + index);   /*  erases the entries from the adjacencyMatrix in every "row" */
     }                                                                               /*  --  */
 }
@@ -56,12 +62,16 @@ Function to insert an Edge
 void Graph::insertEdge(const Edge& edge) {
     int col = this->resolveVertex(edge.getSrc());        //  resolves the src of the edge to the index within the adjacencyMatrix
     int row = this->resolveVertex(edge.getDest());       //  resolves the dest of the edge to the index within the adjacencyMatrix
-    if(col == -1 || row == -1) {                    /*  --  */
-        std::cerr << "Vertex not found!\n";         /*  Calls this->resolveVertex to check if a given vertex is already in the Graph. Returns with an error, if this is the case.   */
+    this->insertEdge(col, row, edge.getDistance());
+}
+
+void Graph::insertEdge(int col, int row, int distance) {
+    if(!this->validVertex(col) || !this->validVertex(row)) {   /*  --  */
+        std::cerr << "Vertex not found!\n";         /*  Returns with an error, if one of the vertices is not in the Graph.   */
         return;                                     /*  --  */
     }
     
-    this->adjacencyMatrix[col][row]= edge.getDistance();   //  sets the value of the adjacencyMatrix at position [col][row] to the weight of the edge
+    this->adjacencyMatrix[col][row]= distance;      //  sets the value of the adjacencyMatrix at position [col][row] to the weight of the edge
   }
 
 /*  --  /
@@ -72,8 +82,12 @@ Function to delete an Edge
 void Graph::deleteEdge(const Edge& edge) {                 
     int col = this->resolveVertex(edge.getSrc());        //  resolves the src of the edge to the index within the adjacencyMatrix
     int row = this->resolveVertex(edge.getDest());       //  resolves the dest of the edge to the index within the adjacencyMatrix
-    if(col == -1 || row == -1) {                    /*  --  */
-        std::cerr << "Vertex not found!\n";         /*  Calls this->resolveVertex to check if a given vertex is already in the Graph. Returns with an error, if this is the case.   */
+    this->deleteEdge(col, row);
+}
+
+void Graph::deleteEdge(int col, int row) {
+    if(!this->validVertex(col) || !this->validVertex(row)) {   /*  --  */
+        std::cerr << "Vertex not found!\n";         /*  Returns with an error, if one of the vertices is not in the Graph.   */
         return;                                     /*  --  */
     }
     this->adjacencyMatrix[col][row]= 0;             //  sets the value of the adjacencyMatrix at position [col][row] to 0
@@ -85,9 +99,11 @@ Function to check whether vertex v2 is adjacent to vertex v1
     - returns void
 /   --  */
 bool Graph::adjacent(const std::string& vertex1, const std::string& vertex2) {
-    int indexVertex1 = this->resolveVertex(vertex1);
-    int indexVertex2 = this->resolveVertex(vertex2);
-    if(indexVertex1 == -1 || indexVertex2 == -1) {
+    return this->adjacent(this->resolveVertex(vertex1), this->resolveVertex(vertex2));
+}
+
+bool Graph::adjacent(int indexVertex1, int indexVertex2) {
+    if(!this->validVertex(indexVertex1) || !this->validVertex(indexVertex2)) {
         std::cerr << "Vertex not found!\n";
         return false;
     }
@@ -109,11 +125,22 @@ this does not automatically imply that "B" is the neighbour of "A".
     - returns a std::vector of std::string
 /   --  */
 std::vector<std::string> Graph::neighbours(const std::string& vertex) {
-    int indexVertex = this->resolveVertex(vertex);                          //  resolves the vertex to the index within the adjacencyMatrix
     std::vector<std::string> resVector = {};                                //  initializes an empty std::vetor of std::string
+    for(int i : this->neighbours(this->resolveVertex(vertex))) {            /*  Loops through the indices of all neighbours */
+        resVector.push_back(this->vertices[i]);                             /*  and adds the vertex (name) to the result vector resVector */
+    }
+    return resVector;
+}
+
+std::vector<int> Graph::neighbours(int indexVertex) {
+    std::vector<int> resVector = {};                                        //  initializes an empty std::vetor of int
+    if(!this->validVertex(indexVertex)) {
+        std::cerr << "Vertex not found!\n";
+        return resVector;
+    }
     for(int i = 0; i < this->adjacencyMatrix[indexVertex].size(); i++) {    /*  Loops through all entries of the subvector of adjacencyMatrix[indexVertex] */
         if(this->adjacencyMatrix[indexVertex][i] != 0) {                    /*  and checks if  the entry at position [indexVertex][i] is not 0. */
-            resVector.push_back(this->vertices[i]);                         /*  If the condition is fulfilled, add the vertex (name) to the result vector resVector */
+            resVector.push_back(i);                                         /*  If the condition is fulfilled, add the index to the result vector resVector */
         }
     }
     return resVector;
@@ -149,12 +176,35 @@ between vertices of type std::string and the corresponding index (in the adjacen
     - function returns -1 in case the resolution of the name is unsuccessful
 /   --  */
 int Graph::resolveVertex(const std::string& vertexName) {
-    for(int i = 0; i < this->vertices.size(); i++) {
-        if(this->vertices[i] == vertexName) {
-            return i;
-        }
+    auto found = this->vertexIds.find(vertexName);
+    if(found == this->vertexIds.end()) {
+        return -1;
     }
-    return -1;
+    return found->second;
+}
+
+/*  --  /
+Function that hashes all names of this->vertices again; a name that occurs twice resolves to its first index,
+like the linear search did before.
+/   --  */
+void Graph::rebuildVertexIds() {
+    this->vertexIds.clear();
+    this->vertexIds.reserve(this->vertices.size());
+    for(int i = 0; i < (int)this->vertices.size(); i++) {
+        this->vertexIds.emplace(this->vertices[i], i);
+    }
+}
+
+bool Graph::validVertex(int vertex) const {
+    return vertex >= 0 && vertex < (int)this->vertices.size();
+}
+
+const std::string& Graph::getVertexName(int vertex) const {
+    return this->vertices.at(vertex);
+}
+
+int Graph::getVertexCount() const {
+    return (int)this->vertices.size();
 }
 
 int Graph::miniDist(const int dist[], const bool sptSet[]){
@@ -182,9 +232,14 @@ void Graph::printPath(int parent[], int j, int dist[]){
 }
 
 void Graph::performDijkstraPath(const std::string& sourceVertex, const std::string& targetVertex){
+    this->performDijkstraPath(this->resolveVertex(sourceVertex), this->resolveVertex(targetVertex));
+}
 
-    auto src = this->resolveVertex(sourceVertex);
-    auto dest = this->resolveVertex(targetVertex);
+void Graph::performDijkstraPath(int src, int dest){
+    if(!this->validVertex(src) || !this->validVertex(dest)) {
+        std::cerr << "Vertex not found!\n";
+        return;
+    }
     auto max_size = vertices.size();
 
     int dist[max_size];
@@ -3,6 +3,7 @@
 #include <iostream> /*  cout, cerr  */
 #include <sstream>  /*  type stringstream to easily concat a result string  */
 #include <limits.h> /*  INT_MAX */
+#include <unordered_map> /*  name -> index lookup in resolveVertex  */
 
 #include "edge.h"
 
@@ -11,6 +12,10 @@ void vectorToString(std::vector<std::string> vector);
 class Graph {
     private:
         std::vector<std::string> vertices;                  //  vector connecting vertices with indices; needed for name resolution
+        std::unordered_map<std::string, int> vertexIds;     //  name -> index in vertices, so resolveVertex does not compare every name
+
+        void rebuildVertexIds();                            //  after vertices changed as a whole or indices moved
+        bool validVertex(int vertex) const;                 //  0 <= vertex < number of vertices
        
     public:
         Graph(){
@@ -27,8 +32,12 @@ class Graph {
             Resolves a given string of a vertex and returns its position in the
             adjacencyMatrix (as integer). Returns -1 if name could not be resolved,
             which indicates the the name was not found. 
+            The names are kept in a hash map, so this is O(1) on average; resolve a name once and use the
+            overloads taking the index (id) below when calling several operations for the same vertex.
         --  */
         int resolveVertex(const std::string& name);
+        const std::string& getVertexName(int vertex) const;
+        int getVertexCount() const;
         void printGraph();    //  prints out the graph with vertices and the adjacencyMatrix
 
         /*  --
@@ -36,17 +45,23 @@ class Graph {
         --  */
         void insertVertex(const std::string& vertex);                           //  inserts a new vertex; throws error, if vertex already exists in Graph
         void deleteVertex(const std::string& vertex);                           //  deletes a vertex from the Graph; throws an error, if vertex does not exist
+        void deleteVertex(int vertex);                                          //  ...the indices of all following vertices move down by one
         void insertEdge(const Edge& edge);                                      //  inserts a new edge; parameter can be {std::string, std::string} due to implicit cast...
                                                                                 //  ...does not check if the edge already exists, nor notifies user/programmer
+        void insertEdge(int source, int destination, int distance);
         void deleteEdge(const Edge& edge);                                      //  deletes an edge; parameter can be {std::string, std::string} due to implicit cast...
                                                                                 //  ...does not check if edge exists
+        void deleteEdge(int source, int destination);
         bool adjacent(const std::string& vertex1, const std::string& vertex2);  //  checks if vertex1 and vertex2 are adjacent; returns boolean; adjacency indicates that...
                                                                                 //  ...a direct connection between a <--> b (direction NOT important) exists
+        bool adjacent(int vertex1, int vertex2);
         std::vector<std::string> neighbours(const std::string& vertex);         //  returns a vector of strings, containing all neighbouring vertices of the parameter vertex...
+        std::vector<int> neighbours(int vertex);                                //  ...or their indices
 
         int miniDist(const int distance[], const bool Tset[]);
 
         void printPath(int parent[], int j, int dist[]);
 
         void performDijkstraPath(const std::string& sourceVertex, const std::string& targetVertex);
+        void performDijkstraPath(int sourceVertex, int targetVertex);
 };
\ No newline at end of file
@@ -0,0 +1,620 @@
+#include "contractionHierarchy.h"
+#include "extendedGraph2.h"
+#include <algorithm>
+#include <climits>
+#include <cstdint>
+#include <fstream>
+#include <iostream>
+#include <queue>
+
+//  a witness search gives up after this many settled vertices, the shortcut is added then even if it is not needed;
+//  the priority only estimates the shortcuts and uses a smaller limit
+static const int witnessSettleLimit = 500;
+static const int simulationSettleLimit = 50;
+
+struct Arc {
+    int vertex;
+    int weight;
+};
+
+struct HierarchyEdge {
+    int from;
+    int to;
+    int weight;
+    int middle;
+};
+
+/*  --
+    The graph of the vertices that are not contracted yet, out[u] and in[u] without duplicate neighbours.
+    Contracting a vertex removes it from the lists of its neighbours and adds the shortcuts between them.
+--  */
+struct ContractionGraph {
+    std::vector<std::vector<Arc>> out;
+    std::vector<std::vector<Arc>> in;
+    std::vector<bool> contracted;
+    std::vector<int> contractedNeighbours;
+    std::vector<HierarchyEdge> edges;           //  edges of the graph and all shortcuts
+    DijkstraWorkspace witness;
+    size_t shortcutCount = 0;
+
+    explicit ContractionGraph(const Graph& graph);
+    std::vector<bool> isTarget;
+    void witnessSearch(int source, int skip, int maxDistance, int targetCount, int settleLimit);
+    int contract(int vertex, bool apply);       //  number of shortcuts, only added if apply
+    int priority(int vertex);
+    void addArc(int from, int to, int weight, int middle);
+};
+
+static void lowerArc(std::vector<Arc>& arcs, int vertex, int weight) {
+    for(auto & arc : arcs) {
+        if(arc.vertex == vertex) {
+            arc.weight = std::min(arc.weight, weight);
+            return;
+        }
+    }
+    arcs.push_back({vertex, weight});
+}
+
+static void removeArc(std::vector<Arc>& arcs, int vertex) {
+    for(size_t i = 0; i < arcs.size(); i++) {
+        if(arcs[i].vertex == vertex) {
+            arcs[i] = arcs.back();
+            arcs.pop_back();
+            return;
+        }
+    }
+}
+
+ContractionGraph::ContractionGraph(const Graph& graph) {
+    int vertexCount = graph.getVertexCount();
+    this->out.resize(vertexCount);
+    this->in.resize(vertexCount);
+    this->contracted.assign(vertexCount, false);
+    this->contractedNeighbours.assign(vertexCount, 0);
+    this->isTarget.assign(vertexCount, false);
+    for(int from = 0; from < vertexCount; from++) {
+        graph.forEachEdge(from, [this, from](int to, int weight) {
+            if(to != from) {
+                this->addArc(from, to, weight, -1);
+            }
+        });
+    }
+}
+
+void ContractionGraph::addArc(int from, int to, int weight, int middle) {
+    lowerArc(this->out[from], to, weight);
+    lowerArc(this->in[to], from, weight);
+    this->edges.push_back({from, to, weight, middle});
+}
+
+//  stops after maxDistance or when all targetCount vertices marked in isTarget are settled
+void ContractionGraph::witnessSearch(int source, int skip, int maxDistance, int targetCount, int settleLimit) {
+    DijkstraWorkspace& w = this->witness;
+    w.prepare((int)this->out.size());
+    w.distances[source] = 0;
+    w.reach(source);
+    w.binaryHeap.push(source, 0);
+    int settledCount = 0;
+    while(!w.binaryHeap.empty() && settledCount < settleLimit && targetCount > 0) {
+        int u = w.binaryHeap.pop();
+        if(w.isSettled(u)) {
+            continue;
+        }
+        w.settle(u);
+        settledCount++;
+        if(w.distances[u] > maxDistance) {
+            break;
+        }
+        if(this->isTarget[u]) {
+            targetCount--;
+        }
+        for(auto & arc : this->out[u]) {
+            if(arc.vertex == skip) {
+                continue;
+            }
+            int distance = w.distances[u] + arc.weight;
+            if(distance < w.distances[arc.vertex]) {
+                if(w.distances[arc.vertex] == INT_MAX) {
+                    w.reach(arc.vertex);
+                }
+                w.distances[arc.vertex] = distance;
+                w.binaryHeap.decrease(arc.vertex, distance);
+            }
+        }
+    }
+}
+
+int ContractionGraph::contract(int vertex, bool apply) {
+    int shortcuts = 0;
+    //  copies, addArc can change the lists of vertex when a neighbour is in and out at the same time
+    std::vector<Arc> incoming = this->in[vertex];
+    std::vector<Arc> outgoing = this->out[vertex];
+    for(auto & from : incoming) {
+        int maxOut = -1;
+        int targetCount = 0;
+        for(auto & to : outgoing) {
+            if(to.vertex != from.vertex) {
+                maxOut = std::max(maxOut, to.weight);
+                this->isTarget[to.vertex] = true;
+                targetCount++;
+            }
+        }
+        if(maxOut < 0) {
+            continue;
+        }
+        this->witnessSearch(from.vertex, vertex, from.weight + maxOut, targetCount,
+                            apply ? witnessSettleLimit : simulationSettleLimit);
+        for(auto & to : outgoing) {
+            this->isTarget[to.vertex] = false;
+        }
+        for(auto & to : outgoing) {
+            if(to.vertex == from.vertex) {
+                continue;
+            }
+            int via = from.weight + to.weight;
+            if(this->witness.distances[to.vertex] <= via) {
+                continue;
+            }
+            shortcuts++;
+            if(apply) {
+                this->addArc(from.vertex, to.vertex, via, vertex);
+                this->shortcutCount++;
+            }
+        }
+    }
+    if(apply) {
+        this->contracted[vertex] = true;
+        for(auto & from : this->in[vertex]) {
+            removeArc(this->out[from.vertex], vertex);
+            this->contractedNeighbours[from.vertex]++;
+        }
+        for(auto & to : this->out[vertex]) {
+            removeArc(this->in[to.vertex], vertex);
+            this->contractedNeighbours[to.vertex]++;
+        }
+        this->in[vertex].clear();
+        this->out[vertex].clear();
+    }
+    return shortcuts;
+}
+
+int ContractionGraph::priority(int vertex) {
+    int removed = (int)(this->in[vertex].size() + this->out[vertex].size());
+    return this->contract(vertex, false) - removed + this->contractedNeighbours[vertex];
+}
+
+//  edges of one direction as offsets/targets/weights/middles, rows sorted by target and only the lightest of parallel edges
+static void buildRows(int vertexCount, std::vector<HierarchyEdge>& edges, std::vector<int>& offsets, std::vector<int>& targets,
+                      std::vector<int>& weights, std::vector<int>& middles) {
+    std::sort(edges.begin(), edges.end(), [](const HierarchyEdge& a, const HierarchyEdge& b) {
+        if(a.from != b.from) return a.from < b.from;
+        if(a.to != b.to) return a.to < b.to;
+        if(a.weight != b.weight) return a.weight < b.weight;
+        return a.middle < b.middle;         //  -1 first, an edge of the graph needs no unpacking
+    });
+    offsets.assign(vertexCount + 1, 0);
+    targets.clear();
+    weights.clear();
+    middles.clear();
+    for(size_t i = 0; i < edges.size(); i++) {
+        if(i > 0 && edges[i].from == edges[i - 1].from && edges[i].to == edges[i - 1].to) {
+            continue;
+        }
+        offsets[edges[i].from + 1]++;
+        targets.push_back(edges[i].to);
+        weights.push_back(edges[i].weight);
+        middles.push_back(edges[i].middle);
+    }
+    for(int vertex = 0; vertex < vertexCount; vertex++) {
+        offsets[vertex + 1] += offsets[vertex];
+    }
+}
+
+ContractionHierarchy::ContractionHierarchy() {
+    this->shortcutCount = 0;
+    this->upOffsets.assign(1, 0);
+    this->downOffsets.assign(1, 0);
+}
+
+ContractionHierarchy::ContractionHierarchy(const Graph& graph) {
+    int vertexCount = graph.getVertexCount();
+    ContractionGraph remaining(graph);
+
+    //  lazy updates: a popped vertex gets its priority again and goes back if it is not the smallest anymore
+    std::vector<int> priorities(vertexCount);
+    std::priority_queue<std::pair<int, int>, std::vector<std::pair<int, int>>, std::greater<std::pair<int, int>>> queue;
+    for(int vertex = 0; vertex < vertexCount; vertex++) {
+        priorities[vertex] = remaining.priority(vertex);
+        queue.emplace(priorities[vertex], vertex);
+    }
+    this->rank.assign(vertexCount, -1);
+    int nextRank = 0;
+    while(!queue.empty()) {
+        std::pair<int, int> top = queue.top();
+        queue.pop();
+        int vertex = top.second;
+        if(remaining.contracted[vertex] || top.first != priorities[vertex]) {
+            continue;                       //  outdated entry
+        }
+        int current = remaining.priority(vertex);
+        if(!queue.empty() && current > queue.top().first) {
+            priorities[vertex] = current;
+            queue.emplace(current, vertex);
+            continue;
+        }
+        std::vector<int> neighbours;
+        for(auto & arc : remaining.in[vertex]) {
+            neighbours.push_back(arc.vertex);
+        }
+        for(auto & arc : remaining.out[vertex]) {
+            neighbours.push_back(arc.vertex);
+        }
+        remaining.contract(vertex, true);
+        this->rank[vertex] = nextRank++;
+        std::sort(neighbours.begin(), neighbours.end());
+        neighbours.erase(std::unique(neighbours.begin(), neighbours.end()), neighbours.end());
+        for(int neighbour : neighbours) {
+            priorities[neighbour] = remaining.priority(neighbour);
+            queue.emplace(priorities[neighbour], neighbour);
+        }
+    }
+    this->shortcutCount = remaining.shortcutCount;
+
+    std::vector<HierarchyEdge> upEdges;
+    std::vector<HierarchyEdge> downEdges;
+    for(auto & edge : remaining.edges) {
+        if(this->rank[edge.from] < this->rank[edge.to]) {
+            upEdges.push_back(edge);
+        } else {
+            downEdges.push_back({edge.to, edge.from, edge.weight, edge.middle});
+        }
+    }
+    remaining.edges.clear();
+    remaining.edges.shrink_to_fit();
+    buildRows(vertexCount, upEdges, this->upOffsets, this->upTargets, this->upWeights, this->upMiddles);
+    buildRows(vertexCount, downEdges, this->downOffsets, this->downTargets, this->downWeights, this->downMiddles);
+}
+
+int ContractionHierarchy::getVertexCount() const {
+    return (int)this->rank.size();
+}
+
+size_t ContractionHierarchy::getShortcutCount() const {
+    return this->shortcutCount;
+}
+
+/*  --
+    One step of an upward search: settles the next vertex of workspace and relaxes its edges in (offsets, targets,
+    weights). A vertex is stalled (its edges are not relaxed) if a higher vertex the search reached already has an
+    edge towards it in (stallOffsets, ...) that gives a shorter distance; its own distance can not be on a shortest
+    path then. Returns false when the search is done: nothing left or the smallest distance is not below best.
+--  */
+static bool upwardStep(DijkstraWorkspace& workspace, const DijkstraWorkspace& other, int& best, int& meet,
+                       const std::vector<int>& offsets, const std::vector<int>& targets, const std::vector<int>& weights,
+                       const std::vector<int>& stallOffsets, const std::vector<int>& stallTargets, const std::vector<int>& stallWeights) {
+    int u = -1;
+    while(!workspace.binaryHeap.empty()) {
+        int candidate = workspace.binaryHeap.pop();
+        if(!workspace.isSettled(candidate)) {
+            u = candidate;
+            break;
+        }
+    }
+    if(u == -1 || workspace.distances[u] >= best) {
+        return false;
+    }
+    workspace.settle(u);
+    int distance = workspace.distances[u];
+    if(other.distances[u] != INT_MAX && (long long)distance + other.distances[u] < best) {
+        best = distance + other.distances[u];
+        meet = u;
+    }
+    for(int i = stallOffsets[u]; i < stallOffsets[u + 1]; i++) {
+        int higher = stallTargets[i];
+        if(workspace.distances[higher] != INT_MAX && (long long)workspace.distances[higher] + stallWeights[i] < distance) {
+            return true;
+        }
+    }
+    for(int i = offsets[u]; i < offsets[u + 1]; i++) {
+        int v = targets[i];
+        long long next = (long long)distance + weights[i];     //  a loaded file may hold weights close to INT_MAX
+        if(next < workspace.distances[v]) {
+            if(workspace.distances[v] == INT_MAX) {
+                workspace.reach(v);
+            }
+            workspace.distances[v] = (int)next;
+            workspace.parents[v] = u;
+            workspace.binaryHeap.decrease(v, (int)next);
+        }
+    }
+    return true;
+}
+
+int ContractionHierarchy::search(int source, int target, int& meet) {
+    int vertexCount = this->getVertexCount();
+    meet = -1;
+    if(source < 0 || source >= vertexCount || target < 0 || target >= vertexCount) {
+        return INT_MAX;
+    }
+    this->forward.prepare(vertexCount);
+    this->backward.prepare(vertexCount);
+    this->forward.distances[source] = 0;
+    this->forward.reach(source);
+    this->forward.binaryHeap.push(source, 0);
+    this->backward.distances[target] = 0;
+    this->backward.reach(target);
+    this->backward.binaryHeap.push(target, 0);
+
+    int best = INT_MAX;
+    bool forwardActive = true;
+    bool backwardActive = true;
+    while(forwardActive || backwardActive) {
+        if(forwardActive) {
+            forwardActive = upwardStep(this->forward, this->backward, best, meet,
+                                       this->upOffsets, this->upTargets, this->upWeights,
+                                       this->downOffsets, this->downTargets, this->downWeights);
+        }
+        if(backwardActive) {
+            backwardActive = upwardStep(this->backward, this->forward, best, meet,
+                                        this->downOffsets, this->downTargets, this->downWeights,
+                                        this->upOffsets, this->upTargets, this->upWeights);
+        }
+    }
+    return best;
+}
+
+int ContractionHierarchy::distance(int sourceVertex, int targetVertex) {
+    int meet;
+    return this->search(sourceVertex, targetVertex, meet);
+}
+
+//  position of target in the row of (offsets, targets), sorted by target; -1 if it is not there
+static int findInRow(const std::vector<int>& offsets, const std::vector<int>& targets, int row, int target) {
+    auto first = targets.begin() + offsets[row];
+    auto last = targets.begin() + offsets[row + 1];
+    auto found = std::lower_bound(first, last, target);
+    if(found == last || *found != target) {
+        return -1;
+    }
+    return (int)(found - targets.begin());
+}
+
+bool ContractionHierarchy::middleOf(int from, int to, int& middle) const {
+    if(this->rank[from] < this->rank[to]) {
+        int position = findInRow(this->upOffsets, this->upTargets, from, to);
+        if(position == -1) {
+            return false;
+        }
+        middle = this->upMiddles[position];
+        return true;
+    }
+    int position = findInRow(this->downOffsets, this->downTargets, to, from);
+    if(position == -1) {
+        return false;
+    }
+    middle = this->downMiddles[position];
+    return true;
+}
+
+bool ContractionHierarchy::unpack(int from, int to, std::vector<int>& path) const {
+    //  explicit stack, the shortcuts can be nested as deep as the path is long
+    std::vector<std::pair<int, int>> stack;
+    stack.emplace_back(from, to);
+    while(!stack.empty()) {
+        std::pair<int, int> edge = stack.back();
+        stack.pop_back();
+        int middle;
+        if(!this->middleOf(edge.first, edge.second, middle)) {
+            return false;
+        }
+        if(middle == -1) {
+            path.push_back(edge.second);
+        } else {
+            stack.emplace_back(middle, edge.second);
+            stack.emplace_back(edge.first, middle);
+        }
+    }
+    return true;
+}
+
+std::vector<int> ContractionHierarchy::shortestPath(int sourceVertex, int targetVertex) {
+    std::vector<int> path;
+    int meet;
+    if(this->search(sourceVertex, targetVertex, meet) == INT_MAX) {
+        return path;
+    }
+    //  vertices of the hierarchy path: source ... meet from the forward parents, meet ... target from the backward ones
+    std::vector<int> hierarchyPath;
+    for(int vertex = meet; vertex != -1; vertex = this->forward.parents[vertex]) {
+        hierarchyPath.push_back(vertex);
+    }
+    std::reverse(hierarchyPath.begin(), hierarchyPath.end());
+    for(int vertex = this->backward.parents[meet]; vertex != -1; vertex = this->backward.parents[vertex]) {
+        hierarchyPath.push_back(vertex);
+    }
+    path.push_back(hierarchyPath[0]);
+    for(size_t i = 1; i < hierarchyPath.size(); i++) {
+        if(!this->unpack(hierarchyPath[i - 1], hierarchyPath[i], path)) {
+            path.clear();               //  only possible with a damaged hierarchy, load() rejects those
+            break;
+        }
+    }
+    return path;
+}
+
+static const char fileMagic[4] = {'C', 'H', 'I', 'E'};
+static const int32_t fileVersion = 1;
+
+static void writeInts(std::ofstream& file, const std::vector<int>& values) {
+    int64_t size = (int64_t)values.size();
+    file.write((const char*)&size, sizeof(size));
+    file.write((const char*)values.data(), (std::streamsize)(values.size() * sizeof(int)));
+}
+
+//  fileSize bounds the size before anything is allocated, a damaged size can not ask for more than the file holds
+static bool readInts(std::ifstream& file, std::streamoff fileSize, std::vector<int>& values) {
+    int64_t size = 0;
+    if(!file.read((char*)&size, sizeof(size)) || size < 0 || size > INT_MAX
+       || size > (int64_t)((fileSize - file.tellg()) / (std::streamoff)sizeof(int))) {
+        return false;
+    }
+    values.resize((size_t)size);
+    return (bool)file.read((char*)values.data(), (std::streamsize)(size * sizeof(int)));
+}
+
+bool ContractionHierarchy::save(const std::string& fileName) const {
+    std::ofstream file(fileName, std::ios::binary);
+    if(!file) {
+        std::cerr << "Could not open " << fileName << " for writing" << std::endl;
+        return false;
+    }
+    int64_t shortcuts = (int64_t)this->shortcutCount;
+    file.write(fileMagic, sizeof(fileMagic));
+    file.write((const char*)&fileVersion, sizeof(fileVersion));
+    file.write((const char*)&shortcuts, sizeof(shortcuts));
+    writeInts(file, this->rank);
+    writeInts(file, this->upOffsets);
+    writeInts(file, this->upTargets);
+    writeInts(file, this->upWeights);
+    writeInts(file, this->upMiddles);
+    writeInts(file, this->downOffsets);
+    writeInts(file, this->downTargets);
+    writeInts(file, this->downWeights);
+    writeInts(file, this->downMiddles);
+    if(!file) {
+        std::cerr << "Could not write " << fileName << std::endl;
+        return false;
+    }
+    return true;
+}
+
+/*  --
+    The indices are in range already; the queries and unpack() also rely on
+        - rank being a permutation of 0 .. V-1 and the weights not being negative
+        - every row being strictly sorted (binary search, no parallel edges)
+        - up edges leading to a higher rank and down edges coming from one
+        - every shortcut from -> to with middle m having rank[m] below both ends and the edges from -> m and
+          m -> to; each unpacking step then lowers the smallest rank on the edge, so it ends
+--  */
+bool ContractionHierarchy::consistent() const {
+    int vertexCount = this->getVertexCount();
+    std::vector<bool> rankTaken(vertexCount, false);
+    for(int vertexRank : this->rank) {
+        if(vertexRank < 0 || vertexRank >= vertexCount || rankTaken[vertexRank]) {
+            return false;
+        }
+        rankTaken[vertexRank] = true;
+    }
+    for(int weight : this->upWeights) {
+        if(weight < 0) {
+            return false;
+        }
+    }
+    for(int weight : this->downWeights) {
+        if(weight < 0) {
+            return false;
+        }
+    }
+    for(int vertex = 0; vertex < vertexCount; vertex++) {
+        for(int i = this->upOffsets[vertex]; i < this->upOffsets[vertex + 1]; i++) {
+            int to = this->upTargets[i];
+            int middle = this->upMiddles[i];
+            if(i > this->upOffsets[vertex] && this->upTargets[i - 1] >= to) {
+                return false;
+            }
+            if(this->rank[to] <= this->rank[vertex]) {
+                return false;
+            }
+            int check;
+            if(middle != -1 && (this->rank[middle] >= this->rank[vertex]
+                                || !this->middleOf(vertex, middle, check) || !this->middleOf(middle, to, check))) {
+                return false;
+            }
+        }
+        for(int i = this->downOffsets[vertex]; i < this->downOffsets[vertex + 1]; i++) {
+            int from = this->downTargets[i];
+            int middle = this->downMiddles[i];
+            if(i > this->downOffsets[vertex] && this->downTargets[i - 1] >= from) {
+                return false;
+            }
+            if(this->rank[from] <= this->rank[vertex]) {
+                return false;
+            }
+            int check;
+            if(middle != -1 && (this->rank[middle] >= this->rank[vertex]
+                                || !this->middleOf(from, middle, check) || !this->middleOf(middle, vertex, check))) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+bool ContractionHierarchy::load(const std::string& fileName) {
+    std::ifstream file(fileName, std::ios::binary);
+    if(!file) {
+        std::cerr << "Could not open " << fileName << std::endl;
+        return false;
+    }
+    file.seekg(0, std::ios::end);
+    std::streamoff fileSize = file.tellg();
+    file.seekg(0, std::ios::beg);
+    char magic[4];
+    int32_t version = 0;
+    int64_t shortcuts = 0;
+    file.read(magic, sizeof(magic));
+    file.read((char*)&version, sizeof(version));
+    file.read((char*)&shortcuts, sizeof(shortcuts));
+    if(!file || !std::equal(magic, magic + 4, fileMagic) || version != fileVersion) {
+        std::cerr << fileName << " is not a contraction hierarchy of this version" << std::endl;
+        return false;
+    }
+    ContractionHierarchy loaded;
+    bool complete = readInts(file, fileSize, loaded.rank)
+            && readInts(file, fileSize, loaded.upOffsets) && readInts(file, fileSize, loaded.upTargets)
+            && readInts(file, fileSize, loaded.upWeights) && readInts(file, fileSize, loaded.upMiddles)
+            && readInts(file, fileSize, loaded.downOffsets) && readInts(file, fileSize, loaded.downTargets)
+            && readInts(file, fileSize, loaded.downWeights) && readInts(file, fileSize, loaded.downMiddles);
+    //  sizes have to fit together, the queries index with them without checks
+    size_t vertexCount = loaded.rank.size();
+    if(complete) {
+        complete = loaded.upOffsets.size() == vertexCount + 1 && loaded.downOffsets.size() == vertexCount + 1
+                && loaded.upOffsets.front() == 0 && loaded.downOffsets.front() == 0
+                && (size_t)loaded.upOffsets.back() == loaded.upTargets.size()
+                && (size_t)loaded.downOffsets.back() == loaded.downTargets.size()
+                && loaded.upWeights.size() == loaded.upTargets.size() && loaded.upMiddles.size() == loaded.upTargets.size()
+                && loaded.downWeights.size() == loaded.downTargets.size() && loaded.downMiddles.size() == loaded.downTargets.size()
+                && std::is_sorted(loaded.upOffsets.begin(), loaded.upOffsets.end())
+                && std::is_sorted(loaded.downOffsets.begin(), loaded.downOffsets.end());
+    }
+    if(complete) {
+        for(int target : loaded.upTargets) {
+            complete = complete && target >= 0 && (size_t)target < vertexCount;
+        }
+        for(int target : loaded.downTargets) {
+            complete = complete && target >= 0 && (size_t)target < vertexCount;
+        }
+        for(int middle : loaded.upMiddles) {
+            complete = complete && middle >= -1 && middle < (int)vertexCount;
+        }
+        for(int middle : loaded.downMiddles) {
+            complete = complete && middle >= -1 && middle < (int)vertexCount;
+        }
+    }
+    complete = complete && loaded.consistent();
+    if(!complete) {
+        std::cerr << fileName << " is damaged" << std::endl;
+        return false;
+    }
+    this->rank = std::move(loaded.rank);
+    this->upOffsets = std::move(loaded.upOffsets);
+    this->upTargets = std::move(loaded.upTargets);
+    this->upWeights = std::move(loaded.upWeights);
+    this->upMiddles = std::move(loaded.upMiddles);
+    this->downOffsets = std::move(loaded.downOffsets);
+    this->downTargets = std::move(loaded.downTargets);
+    this->downWeights = std::move(loaded.downWeights);
+    this->downMiddles = std::move(loaded.downMiddles);
+    this->shortcutCount = (size_t)shortcuts;
+    return true;
+}
@@ -0,0 +1,63 @@
+#ifndef AUFGABE_3_2_CONTRACTIONHIERARCHY_H
+#define AUFGABE_3_2_CONTRACTIONHIERARCHY_H
+
+#include <vector>
+#include <string>
+#include "dijkstra.h"
+
+class Graph;
+
+/*  --
+    Contraction hierarchy over the vertices of a Graph for many shortest-path queries on a graph that does not change.
+    Preprocessing contracts the vertices one by one, the one with the smallest edge difference (shortcuts needed
+    minus edges removed, plus the neighbours contracted already) first. Contracting v adds a shortcut u -> x for
+    every path u -> v -> x that a witness search (limited Dijkstra from u around v) can not beat; the order of
+    contraction is the rank of a vertex.
+    A query searches upwards from the source over the edges to higher ranks and from the target over the edges
+    from higher ranks; every shortest path has a highest vertex where both searches meet, and only a few hundred
+    vertices are settled even on large graphs. The shortcuts on the path are unpacked into the original vertices.
+    The hierarchy refers to vertex ids of the graph; it has to be built again after the graph was changed.
+--  */
+class ContractionHierarchy {
+    public:
+        ContractionHierarchy();                             //  empty hierarchy, to be filled by load()
+        explicit ContractionHierarchy(const Graph& graph);  //  preprocessing, weights must not be negative
+
+        std::vector<int> shortestPath(int sourceVertex, int targetVertex);     //  vertex ids of the graph, empty if unreachable
+        int distance(int sourceVertex, int targetVertex);                      //  INT_MAX if unreachable
+
+        //  binary file in the byte order of the machine; false (and a message on std::cerr) if the file can not be used
+        bool save(const std::string& fileName) const;
+        bool load(const std::string& fileName);
+
+        int getVertexCount() const;
+        size_t getShortcutCount() const;
+
+    private:
+        std::vector<int> rank;                              //  position of the vertex in the contraction order
+
+        /*  --
+            up: for every vertex u the edges u -> x with rank[x] > rank[u], sorted by x
+            down: for every vertex x the edges u -> x with rank[u] > rank[x], stored as u and sorted by u
+            middle is the vertex a shortcut was made for, -1 for an edge of the graph
+        --  */
+        std::vector<int> upOffsets;
+        std::vector<int> upTargets;
+        std::vector<int> upWeights;
+        std::vector<int> upMiddles;
+        std::vector<int> downOffsets;
+        std::vector<int> downTargets;
+        std::vector<int> downWeights;
+        std::vector<int> downMiddles;
+        size_t shortcutCount;
+
+        DijkstraWorkspace forward;
+        DijkstraWorkspace backward;
+
+        int search(int source, int target, int& meet);     //  both upward searches, returns the distance
+        bool middleOf(int from, int to, int& middle) const; //  middle of the edge from -> to in up or down, false if there is none
+        bool unpack(int from, int to, std::vector<int>& path) const;   //  appends the vertices after from up to to
+        bool consistent() const;                            //  checks a loaded hierarchy, see load()
+};
+
+#endif //AUFGABE_3_2_CONTRACTIONHIERARCHY_H
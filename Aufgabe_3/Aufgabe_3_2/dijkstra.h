@@ -0,0 +1,135 @@
+#ifndef AUFGABE_3_2_DIJKSTRA_H
+#define AUFGABE_3_2_DIJKSTRA_H
+
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <functional>
+
+/*  --
+    Priority queues for Graph::performDijkstra, all with the same interface:
+        - push(vertex, key): vertex is not in the queue yet
+        - decrease(vertex, key): vertex is in the queue and key is smaller than its key so far
+        - pop(): removes a vertex with the smallest key and returns it
+    BinaryHeap and RadixHeap do not look for the old entry on decrease, they add a second one; pop() can then
+    return a vertex that was already returned before, performDijkstra skips those.
+    The vertices are the indices of the graph, keys are distances and must not be negative.
+--  */
+
+//  std::push_heap/pop_heap on (key, vertex) pairs, decrease adds a new pair
+class BinaryHeap {
+    public:
+        void clear();
+        bool empty() const;
+        void push(int vertex, int key);
+        void decrease(int vertex, int key);
+        int pop();
+
+    private:
+        std::vector<std::pair<int, int>> entries;
+};
+
+//  4-ary heap with the position of every vertex, so decrease moves the entry up instead of adding one
+class FourAryHeap {
+    public:
+        void clear();
+        bool empty() const;
+        void push(int vertex, int key);
+        void decrease(int vertex, int key);
+        int pop();
+
+    private:
+        std::vector<int> vertices;          //  heap order
+        std::vector<int> keys;              //  keys[i] belongs to vertices[i]
+        std::vector<int> positions;         //  index in vertices, -1 if the vertex is not in the heap
+
+        void moveUp(int position);
+        void moveDown(int position);
+        void place(int position, int vertex, int key);
+};
+
+//  pairing heap with one node per vertex (child, sibling and previous are vertex indices), decrease cuts the subtree
+//  and melds it with the root; pop pairs the children of the root from left to right and melds them from right to left
+class PairingHeap {
+    public:
+        PairingHeap();
+        void clear();
+        bool empty() const;
+        void push(int vertex, int key);
+        void decrease(int vertex, int key);
+        int pop();
+
+    private:
+        std::vector<int> keys;
+        std::vector<int> child;             //  leftmost child, -1 if none
+        std::vector<int> sibling;           //  next sibling to the right, -1 if none
+        std::vector<int> previous;          //  left sibling, or the parent for a leftmost child, -1 for the root
+        std::vector<int> pairs;             //  scratch space of pop
+        int root;
+
+        int meld(int first, int second);
+};
+
+/*  --
+    Radix heap for integer keys that never go below the last popped key (true for Dijkstra with non-negative
+    weights): bucket 0 holds the keys equal to last, bucket i the keys whose highest bit differing from last is
+    bit i-1. pop() empties the first non-empty bucket into the lower ones, every key moves down at most 32 times.
+--  */
+class RadixHeap {
+    public:
+        RadixHeap();
+        void clear();
+        bool empty() const;
+        void push(int vertex, int key);
+        void decrease(int vertex, int key);
+        int pop();
+
+    private:
+        static const int bucketCount = 33;
+
+        std::vector<std::pair<uint32_t, int>> buckets[bucketCount];
+        uint32_t last;
+        size_t count;
+
+        static int bucketOf(uint32_t key, uint32_t last);
+};
+
+enum class DijkstraHeap { Binary, FourAry, Pairing, Radix };
+
+/*  --
+    Results and scratch memory of Graph::performDijkstra. Keep one workspace and pass it to every query: the
+    vectors and heaps keep their memory, and only the entries the last query changed are reset, so a short query
+    on a large graph does not pay O(V) for initialisation.
+        - distances[v]: length of the shortest path from the source, INT_MAX if v was not reached
+        - parents[v]: predecessor of v on that path, -1 for the source and vertices that were not reached
+    With a target the search stops as soon as the target is settled; the other distances are upper bounds then.
+--  */
+class DijkstraWorkspace {
+    public:
+        std::vector<int> distances;
+        std::vector<int> parents;
+
+        void prepare(int vertexCount);      //  called by performDijkstra
+        void reach(int vertex);             //  vertex got its first distance
+        void settle(int vertex);
+        bool isSettled(int vertex) const;
+
+        BinaryHeap binaryHeap;
+        FourAryHeap fourAryHeap;
+        PairingHeap pairingHeap;
+        RadixHeap radixHeap;
+
+    private:
+        std::vector<bool> settled;
+        std::vector<int> touched;           //  vertices that are not in the initial state anymore
+};
+
+/*  --
+    Heuristic for an A* search towards target when the vertices have coordinates (x[v], y[v]): the straight-line
+    distance to target times the lowest weight per unit of length of any edge, rounded down. That is never more
+    than the real distance and consistent. x and y are not copied and have to outlive the heuristic.
+--  */
+std::function<int(int)> straightLineHeuristic(const std::vector<double>& x, const std::vector<double>& y, int target, double weightPerUnit);
+
+#endif //AUFGABE_3_2_DIJKSTRA_H
@@ -1,15 +1,166 @@
 #include <iomanip>
+#include <algorithm>
 #include "extendedGraph2.h"
 
-Graph::Graph(const std::vector<std::string>& vertices, const std::vector<Edge>& edges) {
+Graph::Graph(const std::vector<std::string>& vertices, const std::vector<Edge>& edges, Storage storage) {
     this->vertices = vertices;                                                                  //  definition of this->vertex through parameter vertices (type: std::vector<std::string>)
-    this->adjacencyMatrix.resize(vertices.size(), std::vector<int>(this->vertices.size()));     //  creation of an NxN Matrix, based on the size of vertices
+    this->storage = storage;
+    this->rebuildVertexIds();                                                                   //  every name is hashed once, the edges below only look them up
 
+    if(storage == Storage::CSR) {
+        this->buildCSR(edges);                                                                  //  all edges at once, O(V+E)
+        return;
+    }
+    this->adjacencyMatrix.resize(vertices.size(), std::vector<int>(this->vertices.size()));     //  creation of an NxN Matrix, based on the size of vertices
     for(const auto & edge : edges) {
         insertEdge(edge);                   //  edges are added one by one, utilizing the insertEdge()-Function
     }
 }
 
+/*  --  /
+Function that fills offsets, targets and weights from a list of edges;
+    - counts the edges per source vertex first, so every edge is copied straight to its final row
+    - rows are sorted by target; if an edge is given twice the last one wins and weight 0 means no edge,
+      like calling insertEdge for every edge of the matrix
+/   --  */
+void Graph::buildCSR(const std::vector<Edge>& edges) {
+    int vertexCount = (int)this->vertices.size();
+    std::vector<int> sources;
+    std::vector<std::pair<int, int>> entries;                   //  (target, weight) in the order of edges
+    sources.reserve(edges.size());
+    entries.reserve(edges.size());
+    this->offsets.assign(vertexCount + 1, 0);
+
+    for(const auto & edge : edges) {
+        int source = this->resolveVertex(edge.getSrc());
+        int target = this->resolveVertex(edge.getDest());
+        if(source == -1 || target == -1) {
+            std::cerr << "Vertex not found!\n";
+            continue;
+        }
+        sources.push_back(source);
+        entries.emplace_back(target, edge.getDistance());
+        this->offsets[source + 1]++;
+    }
+    for(int u = 0; u < vertexCount; u++) {
+        this->offsets[u + 1] += this->offsets[u];                //  prefix sums: offsets[u] is the first position of row u
+    }
+
+    std::vector<std::pair<int, int>> rows(entries.size());
+    std::vector<int> cursor(this->offsets.begin(), this->offsets.end() - 1);
+    for(size_t e = 0; e < entries.size(); e++) {
+        rows[cursor[sources[e]]++] = entries[e];
+    }
+
+    this->targets.clear();
+    this->weights.clear();
+    this->targets.reserve(rows.size());
+    this->weights.reserve(rows.size());
+    int begin = 0;
+    for(int u = 0; u < vertexCount; u++) {
+        int end = this->offsets[u + 1];
+        std::stable_sort(rows.begin() + begin, rows.begin() + end,
+                         [](const std::pair<int, int>& a, const std::pair<int, int>& b) { return a.first < b.first; });
+        this->offsets[u] = (int)this->targets.size();
+        for(int e = begin; e < end; e++) {
+            if(e + 1 < end && rows[e + 1].first == rows[e].first) {
+                continue;                                       //  a later edge to the same target overwrites this one
+            }
+            if(rows[e].second != 0) {
+                this->targets.push_back(rows[e].first);
+                this->weights.push_back(rows[e].second);
+            }
+        }
+        begin = end;
+    }
+    this->offsets[vertexCount] = (int)this->targets.size();
+    this->reverseValid = false;
+}
+
+/*  --  /
+Function that fills reverseOffsets, reverseTargets and reverseWeights with the edges of the CSR arrays turned around;
+like buildCSR it counts the edges per vertex first. Going through the sources in order keeps every row sorted.
+/   --  */
+void Graph::buildReverseCSR() {
+    int vertexCount = (int)this->vertices.size();
+    this->reverseOffsets.assign(vertexCount + 1, 0);
+    for(int target : this->targets) {
+        this->reverseOffsets[target + 1]++;
+    }
+    for(int v = 0; v < vertexCount; v++) {
+        this->reverseOffsets[v + 1] += this->reverseOffsets[v];
+    }
+    this->reverseTargets.resize(this->targets.size());
+    this->reverseWeights.resize(this->weights.size());
+    std::vector<int> cursor(this->reverseOffsets.begin(), this->reverseOffsets.end() - 1);
+    for(int u = 0; u < vertexCount; u++) {
+        for(int e = this->offsets[u]; e < this->offsets[u + 1]; e++) {
+            int position = cursor[this->targets[e]]++;
+            this->reverseTargets[position] = u;
+            this->reverseWeights[position] = this->weights[e];
+        }
+    }
+    this->reverseValid = true;
+}
+
+int Graph::findEdge(int source, int target) const {
+    auto first = this->targets.begin() + this->offsets[source];
+    auto last = this->targets.begin() + this->offsets[source + 1];
+    auto found = std::lower_bound(first, last, target);
+    if(found == last || *found != target) {
+        return -1;
+    }
+    return (int)(found - this->targets.begin());
+}
+
+int Graph::edgeWeight(int source, int target) const {
+    if(this->storage == Storage::Matrix) {
+        return this->adjacencyMatrix[source][target];
+    }
+    int e = this->findEdge(source, target);
+    return e == -1 ? 0 : this->weights[e];
+}
+
+/*  --  /
+Function that sets the weight of the edge source -> target in the current storage;
+in CSR the following rows move by one position when an edge is added or removed, O(V+E)
+/   --  */
+void Graph::setEdge(int source, int target, int weight) {
+    if(this->storage == Storage::Matrix) {
+        this->adjacencyMatrix[source][target] = weight;
+        return;
+    }
+    this->reverseValid = false;
+    int e = this->findEdge(source, target);
+    if(e != -1 && weight != 0) {
+        this->weights[e] = weight;
+        return;
+    }
+    if(e == -1 && weight == 0) {
+        return;
+    }
+    if(e != -1) {
+        this->targets.erase(this->targets.begin() + e);
+        this->weights.erase(this->weights.begin() + e);
+        for(int u = source + 1; u < (int)this->offsets.size(); u++) {
+            this->offsets[u]--;
+        }
+        return;
+    }
+    auto first = this->targets.begin() + this->offsets[source];
+    auto last = this->targets.begin() + this->offsets[source + 1];
+    auto position = std::lower_bound(first, last, target) - this->targets.begin();
+    this->targets.insert(this->targets.begin() + position, target);
+    this->weights.insert(this->weights.begin() + position, weight);
+    for(int u = source + 1; u < (int)this->offsets.size(); u++) {
+        this->offsets[u]++;
+    }
+}
+
+Graph::Storage Graph::getStorage() const {
+    return this->storage;
+}
+
 /*  --  /
 Function to insert a vertex into the Graph;
     - takes one argument of type std::string that represents a vertex
@@ -20,7 +171,13 @@ void Graph::insertVertex(const std::string& vertex) {
         std::cerr << "Vertex already in Graph!\n";  /*  Calls this->resolveVertex to check if a given vertex is already in the Graph. Returns with an error, if this is the case.   */
         return;                                     /*  --  */
     }
+    this->vertexIds.emplace(vertex, (int)this->vertices.size());    //  the new vertex gets the next free index
     this->vertices.push_back(vertex);               //  adds a vertetx via the push_back function provided by std::vector
+    if(this->storage == Storage::CSR) {
+        this->offsets.push_back(this->offsets.back());      //  new empty row at the end
+        this->reverseValid = false;
+        return;
+    }
     this->adjacencyMatrix.resize(this->vertices.size(), std::vector<int>(this->vertices.size()));   //  resizes the adjacencyMatrix to the new size
     for(int i = 0; i < (this->vertices.size()); i++) {        /*  --  */
         adjacencyMatrix[i].resize(this->vertices.size());   /*  resizes every "sub" vector of the matrix to the new size    */
@@ -33,15 +190,43 @@ Function to delete a vertex from the Graph;
     - returns void
 /   --  */
 void Graph::deleteVertex(const std::string& vertex) {
-    int index = this->resolveVertex(vertex);
-    if(index == -1) {                               /*  --  */
-        std::cerr << "Vertex not found\n";          /*  Calls this->resolveVertex to check if a given vertex is already in the Graph. Returns with an error, if this is the case.   */
+    this->deleteVertex(this->resolveVertex(vertex));
+}
+
+void Graph::deleteVertex(int index) {
+    if(!this->validVertex(index)) {                 /*  --  */
+        std::cerr << "Vertex not found\n";          /*  Calls this->validVertex to check if a given vertex is in the Graph. Returns with an error, if this is not the case.   */
         return;                                     /*  --  */
     }
     this->vertices.erase(this->vertices.begin() + index);   //  erases the vertex at position "index" from this->vertices
+    this->rebuildVertexIds();                               //  all following vertices moved down by one
+
+    if(this->storage == Storage::CSR) {
+        //  rows behind index move up by one, edges to index are dropped and targets behind it are renumbered
+        std::vector<int> newOffsets(1, 0);
+        std::vector<int> newTargets;
+        std::vector<int> newWeights;
+        for(int u = 0; u + 1 < (int)this->offsets.size(); u++) {
+            if(u == index) {
+                continue;
+            }
+            for(int e = this->offsets[u]; e < this->offsets[u + 1]; e++) {
+                if(this->targets[e] != index) {
+                    newTargets.push_back(this->targets[e] > index ? this->targets[e] - 1 : this->targets[e]);
+                    newWeights.push_back(this->weights[e]);
+                }
+            }
+            newOffsets.push_back((int)newTargets.size());
+        }
+        this->offsets.swap(newOffsets);
+        this->targets.swap(newTargets);
+        this->weights.swap(newWeights);
+        this->reverseValid = false;
+        return;
+    }
 
     this->adjacencyMatrix.erase(this->adjacencyMatrix.begin() + index);             //  erases the entries from the adjacencyMatrix at "column" position "index"
-    for(int i = 0; i < (this->adjacencyMatrix[0].size()); i ++) {                     /*  --  */
+    for(int i = 0; i < (this->adjacencyMatrix.size()); i ++) {                        /*  --  */
         this->adjacencyMatrix[i].erase(this->adjacencyMatrix[i].begin() + index);   /*  erases the entries from the adjacencyMatrix in every "row" */
     }                                                                               /*  --  */
 }
@@ -55,12 +240,16 @@ Function to insert an Edge
 void Graph::insertEdge(const Edge& edge) {
     int col = this->resolveVertex(edge.getSrc());        //  resolves the src of the edge to the index within the adjacencyMatrix
     int row = this->resolveVertex(edge.getDest());       //  resolves the dest of the edge to the index within the adjacencyMatrix
-    if(col == -1 || row == -1) {                    /*  --  */
-        std::cerr << "Vertex not found!\n";         /*  Calls this->resolveVertex to check if a given vertex is already in the Graph. Returns with an error, if this is the case.   */
+    this->insertEdge(col, row, edge.getDistance());
+}
+
+void Graph::insertEdge(int col, int row, int distance) {
+    if(!this->validVertex(col) || !this->validVertex(row)) {   /*  --  */
+        std::cerr << "Vertex not found!\n";         /*  Returns with an error, if one of the vertices is not in the Graph.   */
         return;                                     /*  --  */
     }
     
-    this->adjacencyMatrix[col][row]= edge.getDistance();   //  sets the value of the adjacencyMatrix at position [col][row] to the weight of the edge
+    this->setEdge(col, row, distance);              //  sets the value of the adjacencyMatrix at position [col][row] to the weight of the edge
   }
 
 /*  --  /
@@ -71,11 +260,15 @@ Function to delete an Edge
 void Graph::deleteEdge(const Edge& edge) {                 
     int col = this->resolveVertex(edge.getSrc());        //  resolves the src of the edge to the index within the adjacencyMatrix
     int row = this->resolveVertex(edge.getDest());       //  resolves the dest of the edge to the index within the adjacencyMatrix
-    if(col == -1 || row == -1) {                    /*  --  */
-        std::cerr << "Vertex not found!\n";         /*  Calls this->resolveVertex to check if a given vertex is already in the Graph. Returns with an error, if this is the case.   */
+    this->deleteEdge(col, row);
+}
+
+void Graph::deleteEdge(int col, int row) {
+    if(!this->validVertex(col) || !this->validVertex(row)) {   /*  --  */
+        std::cerr << "Vertex not found!\n";         /*  Returns with an error, if one of the vertices is not in the Graph.   */
         return;                                     /*  --  */
     }
-    this->adjacencyMatrix[col][row]= 0;             //  sets the value of the adjacencyMatrix at position [col][row] to 0
+    this->setEdge(col, row, 0);                     //  sets the value of the adjacencyMatrix at position [col][row] to 0
 }
 
 /*  --  /
@@ -84,16 +277,18 @@ Function to check whether vertex v2 is adjacent to vertex v1
     - returns void
 /   --  */
 bool Graph::adjacent(const std::string& vertex1, const std::string& vertex2) {
-    int indexVertex1 = this->resolveVertex(vertex1);
-    int indexVertex2 = this->resolveVertex(vertex2);
-    if(indexVertex1 == -1 || indexVertex2 == -1) {
+    return this->adjacent(this->resolveVertex(vertex1), this->resolveVertex(vertex2));
+}
+
+bool Graph::adjacent(int indexVertex1, int indexVertex2) {
+    if(!this->validVertex(indexVertex1) || !this->validVertex(indexVertex2)) {
         std::cerr << "Vertex not found!\n";
         return false;
     }
     //  As adjacency is an equivalency relation, we need to check for a possible relation in both direction.
     //  This can be achieved by swapping the the position specifications of the adjacencyMatrix (from [indexVertex1][indexVertex2]
     //  to [indexVertex2][indexVertex1]).
-    if(this->adjacencyMatrix[indexVertex1][indexVertex2] != 0 || this->adjacencyMatrix[indexVertex2][indexVertex1] != 0) {
+    if(this->edgeWeight(indexVertex1, indexVertex2) != 0 || this->edgeWeight(indexVertex2, indexVertex1) != 0) {
         return true;    //  if a connection (in any direction) is found, return true
     } else {
         return false;   //  else, return false
@@ -108,16 +303,25 @@ this does not automatically imply that "B" is the neighbour of "A".
     - returns a std::vector of std::string
 /   --  */
 std::vector<std::string> Graph::neighbours(const std::string& vertex) {
-    int indexVertex = this->resolveVertex(vertex);                          //  resolves the vertex to the index within the adjacencyMatrix
     std::vector<std::string> resVector = {};                                //  initializes an empty std::vetor of std::string
-    for(int i = 0; i < this->adjacencyMatrix[indexVertex].size(); i++) {    /*  Loops through all entries of the subvector of adjacencyMatrix[indexVertex] */
-        if(this->adjacencyMatrix[indexVertex][i] != 0) {                    /*  and checks if  the entry at position [indexVertex][i] is not 0. */
-            resVector.push_back(this->vertices[i]);                         /*  If the condition is fulfilled, add the vertex (name) to the result vector resVector */
-        }
+    for(int i : this->neighbours(this->resolveVertex(vertex))) {            /*  Loops through the indices of all neighbours */
+        resVector.push_back(this->vertices[i]);                             /*  and adds the vertex (name) to the result vector resVector */
     }
     return resVector;
 }
 
+std::vector<int> Graph::neighbours(int indexVertex) {
+    std::vector<int> resVector = {};                                        //  initializes an empty std::vetor of int
+    if(!this->validVertex(indexVertex)) {
+        std::cerr << "Vertex not found!\n";
+        return resVector;
+    }
+    this->forEachEdge(indexVertex, [&resVector](int target, int) {          /*  Loops through all outgoing edges of indexVertex */
+        resVector.push_back(target);                                        /*  and adds the index of their target to the result vector resVector */
+    });
+    return resVector;
+}
+
 /*  --  /
 Function that prints the current Graph's adjacencyMatrix.
     - prints the Graph by utilizing std::cout
@@ -133,7 +337,7 @@ void Graph::printGraph() {
     for(int i=0; i < this->vertices.size(); i++) {
         std::cout << std::left << std::setfill(' ') << std::setw(10) << this->vertices[i] << "-->\t";
         for (int j = 0; j < this->vertices.size(); j++) {
-            std::cout << std::left << std::setfill(' ') << std::setw(10) << this->adjacencyMatrix[i][j] ;
+            std::cout << std::left << std::setfill(' ') << std::setw(10) << this->edgeWeight(i, j) ;
         }
         std::cout << "\n";
     }
@@ -148,107 +352,311 @@ between vertices of type std::string and the corresponding index (in the adjacen
     - function returns -1 in case the resolution of the name is unsuccessful
 /   --  */
 int Graph::resolveVertex(const std::string& vertexName) {
-    for(int i = 0; i < this->vertices.size(); i++) {
-        if(this->vertices[i] == vertexName) {
-            return i;
-        }
+    auto found = this->vertexIds.find(vertexName);
+    if(found == this->vertexIds.end()) {
+        return -1;
     }
-    return -1;
+    return found->second;
 }
 
-int Graph::miniDist(const int dist[], const bool sptSet[]){
-    int min = INT_MAX;
-    int min_index;
-
-    for (int i = 0; i < this->vertices.size(); i++){
-        if (!sptSet[i] && dist[i] <= min){
-            min = dist[i];
-            min_index = i;
-        }
+/*  --  /
+Function that hashes all names of this->vertices again; a name that occurs twice resolves to its first index,
+like the linear search did before.
+/   --  */
+void Graph::rebuildVertexIds() {
+    this->vertexIds.clear();
+    this->vertexIds.reserve(this->vertices.size());
+    for(int i = 0; i < (int)this->vertices.size(); i++) {
+        this->vertexIds.emplace(this->vertices[i], i);
     }
-
-    return min_index;
 }
 
-void Graph::printPath(int parent[], int j, int dist[]){
+bool Graph::validVertex(int vertex) const {
+    return vertex >= 0 && vertex < (int)this->vertices.size();
+}
 
-    if (parent[j] == -1){
-        return;
-    }
+const std::string& Graph::getVertexName(int vertex) const {
+    return this->vertices.at(vertex);
+}
 
-    printPath(parent, parent[j], dist);
-    std::cout << " -(" << dist[j]-dist[parent[j]] << ")-> " << vertices.at(j);
+int Graph::getVertexCount() const {
+    return (int)this->vertices.size();
 }
 
 void Graph::performDijkstraPath(const std::string& sourceVertex, const std::string& targetVertex){
+    this->performDijkstraPath(this->resolveVertex(sourceVertex), this->resolveVertex(targetVertex));
+}
 
-    auto src = this->resolveVertex(sourceVertex);
-    auto dest = this->resolveVertex(targetVertex);
-    int max_size = vertices.size();
+void Graph::performDijkstraPath(int src, int dest){
+    if(!this->validVertex(src) || !this->validVertex(dest)) {
+        std::cerr << "Vertex not found!\n";
+        return;
+    }
+    std::vector<int> path = this->shortestPath(src, dest);
 
-    int dist[max_size];
-    bool sptSet[max_size];
-    int parent[max_size];
+    std::cout << vertices.at(src);
+    for(size_t i = 1; i < path.size(); i++) {
+        std::cout << " -(" << this->edgeWeight(path[i - 1], path[i]) << ")-> " << vertices.at(path[i]);
+    }
+    std::cout << "; Gesamter Zollbetrag: " << this->pathDistance(path) << std::endl;
+}
 
-    for(int i = 0; i < max_size; i++){
-        parent[i] = -1;
-        sptSet[i] = false;
+/*  --  /
+The Dijkstra algorithm for one kind of priority queue;
+    - every vertex is taken out of the queue once with its final distance (settled), later entries of the same
+      vertex in BinaryHeap/RadixHeap are skipped
+    - a vertex reached for the first time is pushed, a shorter path to a vertex in the queue decreases its key
+/   --  */
+template<typename Heap, typename Potential>
+void Graph::runDijkstra(int source, int target, DijkstraWorkspace& workspace, Heap& heap, Potential potential) const {
+    std::vector<int>& distances = workspace.distances;
+    std::vector<int>& parents = workspace.parents;
+
+    distances[source] = 0;
+    workspace.reach(source);
+    heap.push(source, potential(source));
+
+    while(!heap.empty()) {
+        int u = heap.pop();
+        if(workspace.isSettled(u)) {
+            continue;
+        }
+        workspace.settle(u);
+        if(u == target) {
+            return;
+        }
+        this->forEachEdge(u, [&](int v, int weight) {
+            if(workspace.isSettled(v)) {
+                return;
+            }
+            int distance = distances[u] + weight;
+            if(distances[v] == INT_MAX) {
+                distances[v] = distance;
+                parents[v] = u;
+                workspace.reach(v);
+                heap.push(v, distance + potential(v));
+            } else if(distance < distances[v]) {
+                distances[v] = distance;
+                parents[v] = u;
+                heap.decrease(v, distance + potential(v));
+            }
+        });
     }
+}
 
-    for (int i = 0; i < max_size; i++){
-        dist[i] = INT_MAX;
+void Graph::performDijkstra(int src, DijkstraWorkspace& workspace, DijkstraHeap heap, int target) const {
+    workspace.prepare((int)this->vertices.size());
+    if(!this->validVertex(src) || (target != -1 && !this->validVertex(target))) {
+        std::cerr << "Vertex not found!\n";
+        return;
+    }
+    auto noPotential = [](int) { return 0; };
+    switch(heap) {
+        case DijkstraHeap::Binary:
+            this->runDijkstra(src, target, workspace, workspace.binaryHeap, noPotential);
+            break;
+        case DijkstraHeap::FourAry:
+            this->runDijkstra(src, target, workspace, workspace.fourAryHeap, noPotential);
+            break;
+        case DijkstraHeap::Pairing:
+            this->runDijkstra(src, target, workspace, workspace.pairingHeap, noPotential);
+            break;
+        case DijkstraHeap::Radix:
+            this->runDijkstra(src, target, workspace, workspace.radixHeap, noPotential);
+            break;
     }
+}
 
-    dist[src] = 0;
+std::vector<int> Graph::shortestPath(int src, int dest, PathSearch search, const Heuristic& heuristic) {
+    if(!this->validVertex(src) || !this->validVertex(dest)) {
+        std::cerr << "Vertex not found!\n";
+        return {};
+    }
+    if(search == PathSearch::Bidirectional) {
+        return this->bidirectionalSearch(src, dest);
+    }
 
-    for (int count = 0; count < max_size - 1; count++) {
-        int u = miniDist(dist, sptSet);
-        sptSet[u] = true;
+    this->workspace.prepare((int)this->vertices.size());
+    if(search == PathSearch::AStar && heuristic) {
+        //  a settled vertex is never opened again, so the heuristic has to be consistent: with an inconsistent one
+        //  a vertex can be settled before its shortest path is known, and the path returned can be longer
+        this->runDijkstra(src, dest, this->workspace, this->workspace.fourAryHeap, [&heuristic](int vertex) { return heuristic(vertex); });
+    } else {
+        this->runDijkstra(src, dest, this->workspace, this->workspace.radixHeap, [](int) { return 0; });
+    }
 
-        for (int v = 0; v < max_size; v++){
-            if (!sptSet[v] && adjacencyMatrix[u][v] && dist[u] + adjacencyMatrix[u][v] < dist[v]){
-                parent[v] = u;
-                dist[v] = dist[u] + adjacencyMatrix[u][v];
+    std::vector<int> path;
+    if(this->workspace.distances[dest] == INT_MAX) {
+        return path;
+    }
+    for(int vertex = dest; vertex != -1; vertex = this->workspace.parents[vertex]) {
+        path.push_back(vertex);
+    }
+    std::reverse(path.begin(), path.end());
+    return path;
+}
+
+/*  --  /
+Bidirectional Dijkstra between source and target;
+    - this->workspace searches from source over the edges, this->backwardWorkspace from target over the reversed
+      edges (its parents point towards target); each step settles one vertex on the side with the smaller radius
+    - whenever one side lowers the distance of a vertex the other side has reached, both distances together are a
+      path; best is the shortest of them and meet the vertex where it goes from one side to the other
+    - every vertex not settled yet is at least as far as the radius of its side, so once the two radii add up to best
+      no shorter path can be found; a side that runs out of vertices has seen every path as well
+/   --  */
+std::vector<int> Graph::bidirectionalSearch(int source, int target) {
+    if(this->storage == Storage::CSR && !this->reverseValid) {
+        this->buildReverseCSR();
+    }
+    int vertexCount = (int)this->vertices.size();
+    DijkstraWorkspace& forward = this->workspace;
+    DijkstraWorkspace& backward = this->backwardWorkspace;
+    forward.prepare(vertexCount);
+    backward.prepare(vertexCount);
+
+    forward.distances[source] = 0;
+    forward.reach(source);
+    forward.radixHeap.push(source, 0);
+    backward.distances[target] = 0;
+    backward.reach(target);
+    backward.radixHeap.push(target, 0);
+
+    long long best = source == target ? 0 : LLONG_MAX;
+    int meet = source;
+    int forwardRadius = 0;
+    int backwardRadius = 0;
+
+    //  settles the next vertex of one side, false if that side has no vertices left
+    auto step = [&best, &meet](DijkstraWorkspace& own, DijkstraWorkspace& other, int& radius, auto forEach) {
+        RadixHeap& heap = own.radixHeap;
+        while(!heap.empty()) {
+            int u = heap.pop();
+            if(own.isSettled(u)) {
+                continue;
             }
+            own.settle(u);
+            radius = own.distances[u];
+            forEach(u, [&](int v, int weight) {
+                if(own.isSettled(v)) {
+                    return;
+                }
+                int distance = own.distances[u] + weight;
+                if(own.distances[v] == INT_MAX) {
+                    own.reach(v);
+                    heap.push(v, distance);
+                } else if(distance < own.distances[v]) {
+                    heap.decrease(v, distance);
+                } else {
+                    return;
+                }
+                own.distances[v] = distance;
+                own.parents[v] = u;
+                if(other.distances[v] != INT_MAX && (long long)distance + other.distances[v] < best) {
+                    best = (long long)distance + other.distances[v];
+                    meet = v;
+                }
+            });
+            return true;
+        }
+        return false;
+    };
+    auto outgoing = [this](int u, auto visit) { this->forEachEdge(u, visit); };
+    auto incoming = [this](int u, auto visit) { this->forEachIncomingEdge(u, visit); };
+
+    while((long long)forwardRadius + backwardRadius < best) {
+        bool forwardTurn = forwardRadius <= backwardRadius;
+        bool progressed = forwardTurn ? step(forward, backward, forwardRadius, outgoing)
+                                      : step(backward, forward, backwardRadius, incoming);
+        if(!progressed) {
+            break;
         }
     }
-    std::cout << vertices.at(src);
-    printPath(parent, dest, dist);
-    std::cout << "; Gesamter Zollbetrag: " << dist[dest] << std::endl;
+
+    std::vector<int> path;
+    if(best == LLONG_MAX) {
+        return path;
+    }
+    for(int vertex = meet; vertex != -1; vertex = forward.parents[vertex]) {
+        path.push_back(vertex);
+    }
+    std::reverse(path.begin(), path.end());
+    for(int vertex = backward.parents[meet]; vertex != -1; vertex = backward.parents[vertex]) {
+        path.push_back(vertex);
+    }
+    return path;
+}
+
+int Graph::pathDistance(const std::vector<int>& path) const {
+    if(path.empty()) {
+        return INT_MAX;
+    }
+    int distance = 0;
+    for(size_t i = 1; i < path.size(); i++) {
+        distance += this->edgeWeight(path[i - 1], path[i]);
+    }
+    return distance;
 }
 
 
 void Graph::depthFirstSearch(std::string vertex)
 {
+    this->depthFirstSearch(this->resolveVertex(vertex));
+}
+
+void Graph::depthFirstSearch(int i)
+{
+    if(!this->validVertex(i)) {
+        std::cerr << "Vertex not found!\n";
+        return;
+    }
 
-    int i = this->resolveVertex(vertex);
+    this->checkedNodes.resize(this->vertices.size(), false);
 
-    checkedNodes[i] = true;
-    std::cout << "<" << this->vertices.at(i) << ">" << " -> ";
-    std::vector<std::string> neighbours = this->neighbours(this->vertices.at(i));
+    //  same order as the recursive version, but with an own stack: a path through a large graph
+    //  would need one call per vertex and overflow the call stack
+    std::vector<std::pair<std::vector<int>, size_t>> stack;     //  neighbours of a vertex on the path, next one to check
+    auto visit = [this, &stack](int vertex) {
+        this->checkedNodes[vertex] = true;
+        std::cout << "<" << this->vertices.at(vertex) << ">" << " -> ";
+        stack.emplace_back(this->neighbours(vertex), 0);
+    };
 
-    for(auto & neighbour : neighbours)
+    visit(i);
+    while(!stack.empty())
     {
-        int a = this->resolveVertex(neighbour);
+        auto& top = stack.back();
+        if (top.second == top.first.size()) {
+            stack.pop_back();
+            continue;
+        }
+        int a = top.first[top.second++];
         if (!checkedNodes[a])
-            depthFirstSearch(this->vertices.at(a));
+            visit(a);
     }
 }
 
 
 int Graph::getEdgeWeight(std::string sourceVertex, std::string targetVertex) {
+    return this->getEdgeWeight(this->resolveVertex(sourceVertex), this->resolveVertex(targetVertex));
+}
+
+int Graph::getEdgeWeight(int sourceVertex, int targetVertex) {
 
     if(this->adjacent(sourceVertex,targetVertex)){
-        return adjacencyMatrix[this->resolveVertex(sourceVertex)][this->resolveVertex(targetVertex)];
+        return this->edgeWeight(sourceVertex, targetVertex);
     }
     return 0;
 }
 
 void Graph::setEdgeWeight(std::string sourceVertex, std::string targetVertex, int weight) {
-    if(getEdgeWeight(sourceVertex,targetVertex) == 0){
-        auto edge = {sourceVertex,targetVertex};
-        this->adjacencyMatrix[this->resolveVertex(sourceVertex)][this->resolveVertex(targetVertex)] = weight;
-    }else{
-        this->adjacencyMatrix[this->resolveVertex(sourceVertex)][this->resolveVertex(targetVertex)] = weight;
+    this->setEdgeWeight(this->resolveVertex(sourceVertex), this->resolveVertex(targetVertex), weight);
+}
+
+void Graph::setEdgeWeight(int sourceVertex, int targetVertex, int weight) {
+    if(!this->validVertex(sourceVertex) || !this->validVertex(targetVertex)) {
+        std::cerr << "Vertex not found!\n";
+        return;
     }
+    this->setEdge(sourceVertex, targetVertex, weight);
 }
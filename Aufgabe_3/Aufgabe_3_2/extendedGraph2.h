@@ -3,16 +3,58 @@
 #include <iostream> /*  cout, cerr  */
 #include <sstream>  /*  type stringstream to easily concat a result string  */
 #include <limits.h> /*  INT_MAX */
-#include <map>
+#include <unordered_map> /*  name -> index lookup in resolveVertex  */
+#include <functional> /*  heuristic of shortestPath  */
 #include "edge.h"
+#include "dijkstra.h"
 
 void vectorToString(std::vector<std::string> vector);
 
 class Graph {
+    public:
+        /*  --
+            Matrix: the VxV adjacencyMatrix, an edge is any entry != 0.
+            CSR (compressed sparse row): the outgoing edges of vertex u are targets[offsets[u] .. offsets[u+1]), their
+            weights sit at the same positions in weights, sorted by target. O(V+E) memory and neighbours are read one
+            after the other; adjacencyMatrix stays empty. Inserting or deleting single edges or vertices costs O(V+E),
+            so large graphs should be passed to the constructor as a whole.
+        --  */
+        enum class Storage { Matrix, CSR };
+
     private:
         std::vector<std::string> vertices;                  //  vector connecting vertices with indices; needed for name resolution
+        std::unordered_map<std::string, int> vertexIds;     //  name -> index in vertices, so resolveVertex does not compare every name
+
+        void rebuildVertexIds();                            //  after vertices changed as a whole or indices moved
+        bool validVertex(int vertex) const;                 //  0 <= vertex < number of vertices
+
+        std::vector<bool> checkedNodes;                     //  vertices already printed by depthFirstSearch
+
+        Storage storage = Storage::Matrix;
+        std::vector<int> offsets;                           //  CSR: V+1 entries
+        std::vector<int> targets;                           //  CSR: E entries
+        std::vector<int> weights;                           //  CSR: E entries
+
+        void buildCSR(const std::vector<Edge>& edges);
+        int findEdge(int source, int target) const;         //  CSR: position of the edge in targets, -1 if there is none
+        int edgeWeight(int source, int target) const;       //  0 if there is no edge, for both storages
+        void setEdge(int source, int target, int weight);   //  for both storages, weight 0 removes the edge
+
+        //  the edges with source and target swapped, in CSR form; built on the first backward search, reset by every change
+        std::vector<int> reverseOffsets;
+        std::vector<int> reverseTargets;
+        std::vector<int> reverseWeights;
+        bool reverseValid = false;
+
+        void buildReverseCSR();
+
+        DijkstraWorkspace workspace;                        //  reused by performDijkstraPath and shortestPath
+        DijkstraWorkspace backwardWorkspace;                //  search from the target in PathSearch::Bidirectional
 
-        std::map<int, bool> checkedNodes;
+        //  potential(v) is added to the key of v in the heap (A*), distances stay the real ones
+        template<typename Heap, typename Potential>
+        void runDijkstra(int source, int target, DijkstraWorkspace& workspace, Heap& heap, Potential potential) const;
+        std::vector<int> bidirectionalSearch(int source, int target);
        
     public:
         Graph(){
@@ -22,15 +64,55 @@ class Graph {
 
         ~Graph()= default;;
 
-        Graph(const std::vector<std::string>& vertices, const std::vector<Edge>& edges);  //  param. constructor
-        std::vector<std::vector<int>> adjacencyMatrix;      //  vector of vectors containing integers (the adjacency matrix)
+        Graph(const std::vector<std::string>& vertices, const std::vector<Edge>& edges, Storage storage = Storage::Matrix);  //  param. constructor
+        std::vector<std::vector<int>> adjacencyMatrix;      //  vector of vectors containing integers (the adjacency matrix); empty with Storage::CSR
+
+        Storage getStorage() const;
+
+        //  calls visit(source, weight) for every edge that ends in vertex, ordered by source; with Storage::CSR
+        //  buildReverseCSR() has to be called before
+        template<typename Visit>
+        void forEachIncomingEdge(int vertex, Visit visit) const {
+            if(this->storage == Storage::CSR) {
+                for(int e = this->reverseOffsets[vertex]; e < this->reverseOffsets[vertex + 1]; e++) {
+                    visit(this->reverseTargets[e], this->reverseWeights[e]);
+                }
+                return;
+            }
+            for(int i = 0; i < (int)this->adjacencyMatrix.size(); i++) {
+                if(this->adjacencyMatrix[i][vertex] != 0) {
+                    visit(i, this->adjacencyMatrix[i][vertex]);
+                }
+            }
+        }
+
+        //  calls visit(target, weight) for every outgoing edge of vertex, ordered by target
+        template<typename Visit>
+        void forEachEdge(int vertex, Visit visit) const {
+            if(this->storage == Storage::CSR) {
+                for(int e = this->offsets[vertex]; e < this->offsets[vertex + 1]; e++) {
+                    visit(this->targets[e], this->weights[e]);
+                }
+                return;
+            }
+            const std::vector<int>& row = this->adjacencyMatrix[vertex];
+            for(int i = 0; i < (int)row.size(); i++) {
+                if(row[i] != 0) {
+                    visit(i, row[i]);
+                }
+            }
+        }
         
         /*  --
             Resolves a given string of a vertex and returns its position in the
             adjacencyMatrix (as integer). Returns -1 if name could not be resolved,
             which indicates the the name was not found. 
+            The names are kept in a hash map, so this is O(1) on average; resolve a name once and use the
+            overloads taking the index (id) below when calling several operations for the same vertex.
         --  */
         int resolveVertex(const std::string& name);
+        const std::string& getVertexName(int vertex) const;
+        int getVertexCount() const;
         void printGraph();    //  prints out the graph with vertices and the adjacencyMatrix
 
         /*  --
@@ -38,23 +120,53 @@ class Graph {
         --  */
         void insertVertex(const std::string& vertex);                           //  inserts a new vertex; throws error, if vertex already exists in Graph
         void deleteVertex(const std::string& vertex);                           //  deletes a vertex from the Graph; throws an error, if vertex does not exist
+        void deleteVertex(int vertex);                                          //  ...the indices of all following vertices move down by one
         void insertEdge(const Edge& edge);                                      //  inserts a new edge; parameter can be {std::string, std::string} due to implicit cast...
                                                                                 //  ...does not check if the edge already exists, nor notifies user/programmer
+        void insertEdge(int source, int destination, int distance);
         void deleteEdge(const Edge& edge);                                      //  deletes an edge; parameter can be {std::string, std::string} due to implicit cast...
                                                                                 //  ...does not check if edge exists
+        void deleteEdge(int source, int destination);
         bool adjacent(const std::string& vertex1, const std::string& vertex2);  //  checks if vertex1 and vertex2 are adjacent; returns boolean; adjacency indicates that...
                                                                                 //  ...a direct connection between a <--> b (direction NOT important) exists
+        bool adjacent(int vertex1, int vertex2);
         std::vector<std::string> neighbours(const std::string& vertex);         //  returns a vector of strings, containing all neighbouring vertices of the parameter vertex...
+        std::vector<int> neighbours(int vertex);                                //  ...or their indices
+
+        void performDijkstraPath(const std::string& sourceVertex, const std::string& targetVertex);
+        void performDijkstraPath(int sourceVertex, int targetVertex);
 
-        int miniDist(const int distance[], const bool Tset[]);
+        /*  --
+            Dijkstra from sourceVertex with the chosen priority queue, O((V+E) log V) (Radix: O(E + V log C) for
+            the largest distance C). The results are left in workspace, see DijkstraWorkspace; with a targetVertex
+            the search ends once its distance is final. The weights must not be negative.
+        --  */
+        void performDijkstra(int sourceVertex, DijkstraWorkspace& workspace, DijkstraHeap heap = DijkstraHeap::Radix, int targetVertex = -1) const;
 
-        void printPath(int parent[], int j, int dist[]);
+        /*  --
+            Point-to-point query: returns the vertices of a shortest path from sourceVertex to targetVertex (both
+            included), empty if targetVertex can not be reached. Every search stops once the path is known:
+                - Dijkstra: one search from sourceVertex until targetVertex is settled
+                - Bidirectional: a search from sourceVertex and one from targetVertex over the reversed edges take
+                  turns; they stop when their radii add up to the shortest path found where they met
+                - AStar: Dijkstra ordered by distance + heuristic(vertex), so vertices towards targetVertex come
+                  first. heuristic(v) has to be a lower bound of the distance v -> targetVertex and consistent
+                  (heuristic(u) <= weight(u, v) + heuristic(v)), e.g. straightLineHeuristic(); settled vertices are
+                  not opened again, so with an inconsistent one the path may not be a shortest one. Without a
+                  heuristic it is plain Dijkstra
+        --  */
+        enum class PathSearch { Dijkstra, Bidirectional, AStar };
+        using Heuristic = std::function<int(int vertex)>;
 
-        void performDijkstraPath(const std::string& sourceVertex, const std::string& targetVertex);
+        std::vector<int> shortestPath(int sourceVertex, int targetVertex, PathSearch search = PathSearch::Bidirectional, const Heuristic& heuristic = Heuristic());
+        int pathDistance(const std::vector<int>& path) const;      //  sum of the weights along path, INT_MAX for an empty path
 
         void depthFirstSearch(std::string vertex);
+        void depthFirstSearch(int vertex);
 
         int getEdgeWeight(std::string sourceVertex, std::string targetVertex);
+        int getEdgeWeight(int sourceVertex, int targetVertex);
 
         void setEdgeWeight(std::string sourceVertex, std::string targetVertex, int weight);
+        void setEdgeWeight(int sourceVertex, int targetVertex, int weight);
 };
\ No newline at end of file
@@ -1,6 +1,66 @@
 #include <iostream>
 #include <vector>
+#include <random>
+#include <chrono>
 #include "extendedGraph2.h"
+#include "contractionHierarchy.h"
+
+/*  --
+    side x side grid in CSR storage, every vertex is connected to its 4 neighbours in both directions with weights
+    10..12. Vertex row * side + column lies at x = column, y = row, so no path is shorter than 10 per unit of
+    straight-line distance: straightLineHeuristic(x, y, target, 10) is a consistent heuristic for A*.
+--  */
+static Graph gridGraph(int side, std::vector<double>& x, std::vector<double>& y) {
+    std::vector<std::string> names;
+    for(int row = 0; row < side; row++) {
+        for(int column = 0; column < side; column++) {
+            names.push_back(std::to_string(row * side + column));
+            x.push_back(column);
+            y.push_back(row);
+        }
+    }
+    std::mt19937 generator(20220604);
+    std::vector<Edge> edges;
+    for(int vertex = 0; vertex < side * side; vertex++) {
+        if(vertex % side + 1 < side) {
+            edges.emplace_back(names[vertex], names[vertex + 1], 10 + (int)(generator() % 3));
+            edges.emplace_back(names[vertex + 1], names[vertex], 10 + (int)(generator() % 3));
+        }
+        if(vertex + side < side * side) {
+            edges.emplace_back(names[vertex], names[vertex + side], 10 + (int)(generator() % 3));
+            edges.emplace_back(names[vertex + side], names[vertex], 10 + (int)(generator() % 3));
+        }
+    }
+    return Graph(names, edges, Graph::Storage::CSR);
+}
+
+//  count random (source, target) pairs of graph, distances gets the distance of each pair from a full Dijkstra
+static std::vector<std::pair<int, int>> randomQueries(const Graph& graph, int count, std::vector<int>& distances) {
+    std::mt19937 generator(4711);
+    std::vector<std::pair<int, int>> queries;
+    DijkstraWorkspace reference;
+    for(int i = 0; i < count; i++) {
+        int source = (int)(generator() % graph.getVertexCount());
+        int target = (int)(generator() % graph.getVertexCount());
+        graph.performDijkstra(source, reference);
+        queries.emplace_back(source, target);
+        distances.push_back(reference.distances[target]);
+    }
+    return queries;
+}
+
+//  path leads from source to target over edges of graph and is as long as distance
+static bool checkPath(Graph& graph, const std::vector<int>& path, int source, int target, int distance) {
+    if(path.empty() || path.front() != source || path.back() != target) {
+        return false;
+    }
+    for(size_t i = 1; i < path.size(); i++) {
+        if(graph.getEdgeWeight(path[i - 1], path[i]) == 0) {
+            return false;
+        }
+    }
+    return graph.pathDistance(path) == distance;
+}
 
 
 int main() {
@@ -38,5 +98,72 @@ int main() {
 
     g.printGraph();
 
+
+    /*  Point-to-point queries on a 100 x 100 grid, every answer is checked against a full Dijkstra from the source  */
+    std::vector<double> x;
+    std::vector<double> y;
+    Graph grid = gridGraph(100, x, y);
+    std::vector<int> expected;
+    std::vector<std::pair<int, int>> queries = randomQueries(grid, 50, expected);
+
+    const char* names[] = {"Dijkstra", "Bidirectional", "AStar"};
+    Graph::PathSearch searches[] = {Graph::PathSearch::Dijkstra, Graph::PathSearch::Bidirectional, Graph::PathSearch::AStar};
+    for(int s = 0; s < 3; s++) {
+        int correct = 0;
+        auto start = std::chrono::steady_clock::now();
+        for(size_t i = 0; i < queries.size(); i++) {
+            int source = queries[i].first;
+            int target = queries[i].second;
+            Graph::Heuristic heuristic;
+            if(searches[s] == Graph::PathSearch::AStar) {
+                heuristic = straightLineHeuristic(x, y, target, 10);
+            }
+            std::vector<int> path = grid.shortestPath(source, target, searches[s], heuristic);
+            correct += checkPath(grid, path, source, target, expected[i]) ? 1 : 0;
+        }
+        auto end = std::chrono::steady_clock::now();
+        std::cout << names[s] << ": " << correct << " of " << queries.size() << " paths as short as Dijkstra, "
+                  << std::chrono::duration_cast<std::chrono::microseconds>(end - start).count() << " us" << std::endl;
+    }
+
+
+    /*  --
+        Contraction hierarchy of a 30 x 30 grid: built once, saved, loaded again and checked against Dijkstra.
+        The preprocessing is the expensive part; a grid has no hierarchy of fast roads like a road network, so
+        it needs more shortcuts than it has edges and takes seconds for 100 x 100 vertices.
+    --  */
+    std::vector<double> smallX;
+    std::vector<double> smallY;
+    Graph small = gridGraph(30, smallX, smallY);
+    std::vector<int> smallExpected;
+    std::vector<std::pair<int, int>> smallQueries = randomQueries(small, 50, smallExpected);
+
+    auto start = std::chrono::steady_clock::now();
+    ContractionHierarchy hierarchy(small);
+    auto end = std::chrono::steady_clock::now();
+    std::cout << "Contraction hierarchy: " << hierarchy.getShortcutCount() << " shortcuts in "
+              << std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count() << " ms" << std::endl;
+    int source = smallQueries[0].first;
+    int target = smallQueries[0].second;
+    std::vector<int> path = hierarchy.shortestPath(source, target);
+    std::cout << "Path " << source << " -> " << target << ": " << path.size() << " vertices, distance "
+              << hierarchy.distance(source, target) << ", "
+              << (checkPath(small, path, source, target, smallExpected[0]) ? "as short as Dijkstra" : "wrong") << std::endl;
+
+    ContractionHierarchy loaded;
+    if(hierarchy.save("grid.ch") && loaded.load("grid.ch")) {
+        int correct = 0;
+        start = std::chrono::steady_clock::now();
+        for(size_t i = 0; i < smallQueries.size(); i++) {
+            source = smallQueries[i].first;
+            target = smallQueries[i].second;
+            path = loaded.shortestPath(source, target);
+            correct += checkPath(small, path, source, target, smallExpected[i]) ? 1 : 0;
+        }
+        end = std::chrono::steady_clock::now();
+        std::cout << "Loaded hierarchy: " << correct << " of " << smallQueries.size() << " paths as short as Dijkstra, "
+                  << std::chrono::duration_cast<std::chrono::microseconds>(end - start).count() << " us" << std::endl;
+    }
+
     return 0;
 }
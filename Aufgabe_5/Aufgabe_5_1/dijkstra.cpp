@@ -0,0 +1,303 @@
+#include "dijkstra.h"
+#include <algorithm>
+#include <climits>
+#include <functional>
+
+void BinaryHeap::clear() {
+    this->entries.clear();
+}
+
+bool BinaryHeap::empty() const {
+    return this->entries.empty();
+}
+
+void BinaryHeap::push(int vertex, int key) {
+    this->entries.emplace_back(key, vertex);
+    std::push_heap(this->entries.begin(), this->entries.end(), std::greater<std::pair<int, int>>());
+}
+
+void BinaryHeap::decrease(int vertex, int key) {
+    this->push(vertex, key);        //  the old pair stays in the heap and is skipped later
+}
+
+int BinaryHeap::pop() {
+    std::pop_heap(this->entries.begin(), this->entries.end(), std::greater<std::pair<int, int>>());
+    int vertex = this->entries.back().second;
+    this->entries.pop_back();
+    return vertex;
+}
+
+void FourAryHeap::clear() {
+    for(int vertex : this->vertices) {
+        this->positions[vertex] = -1;
+    }
+    this->vertices.clear();
+    this->keys.clear();
+}
+
+bool FourAryHeap::empty() const {
+    return this->vertices.empty();
+}
+
+void FourAryHeap::place(int position, int vertex, int key) {
+    this->vertices[position] = vertex;
+    this->keys[position] = key;
+    this->positions[vertex] = position;
+}
+
+void FourAryHeap::moveUp(int position) {
+    int vertex = this->vertices[position];
+    int key = this->keys[position];
+    while(position > 0) {
+        int parent = (position - 1) / 4;
+        if(this->keys[parent] <= key) {
+            break;
+        }
+        this->place(position, this->vertices[parent], this->keys[parent]);
+        position = parent;
+    }
+    this->place(position, vertex, key);
+}
+
+void FourAryHeap::moveDown(int position) {
+    int size = (int)this->vertices.size();
+    int vertex = this->vertices[position];
+    int key = this->keys[position];
+    while(true) {
+        int first = 4 * position + 1;
+        if(first >= size) {
+            break;
+        }
+        //  smallest of the up to four children
+        int smallest = first;
+        int last = std::min(first + 4, size);
+        for(int child = first + 1; child < last; child++) {
+            if(this->keys[child] < this->keys[smallest]) {
+                smallest = child;
+            }
+        }
+        if(this->keys[smallest] >= key) {
+            break;
+        }
+        this->place(position, this->vertices[smallest], this->keys[smallest]);
+        position = smallest;
+    }
+    this->place(position, vertex, key);
+}
+
+void FourAryHeap::push(int vertex, int key) {
+    if(vertex >= (int)this->positions.size()) {
+        this->positions.resize(vertex + 1, -1);
+    }
+    this->vertices.push_back(vertex);
+    this->keys.push_back(key);
+    this->moveUp((int)this->vertices.size() - 1);
+}
+
+void FourAryHeap::decrease(int vertex, int key) {
+    int position = this->positions[vertex];
+    this->keys[position] = key;
+    this->moveUp(position);
+}
+
+int FourAryHeap::pop() {
+    int vertex = this->vertices[0];
+    this->positions[vertex] = -1;
+    int lastVertex = this->vertices.back();
+    int lastKey = this->keys.back();
+    this->vertices.pop_back();
+    this->keys.pop_back();
+    if(!this->vertices.empty()) {
+        this->place(0, lastVertex, lastKey);
+        this->moveDown(0);
+    }
+    return vertex;
+}
+
+PairingHeap::PairingHeap() {
+    this->root = -1;
+}
+
+void PairingHeap::clear() {
+    this->root = -1;                //  the nodes are set up again by push
+}
+
+bool PairingHeap::empty() const {
+    return this->root == -1;
+}
+
+int PairingHeap::meld(int first, int second) {
+    if(first == -1) {
+        return second;
+    }
+    if(second == -1) {
+        return first;
+    }
+    if(this->keys[second] < this->keys[first]) {
+        std::swap(first, second);
+    }
+    //  second becomes the leftmost child of first
+    this->sibling[second] = this->child[first];
+    if(this->child[first] != -1) {
+        this->previous[this->child[first]] = second;
+    }
+    this->previous[second] = first;
+    this->child[first] = second;
+    this->sibling[first] = -1;
+    this->previous[first] = -1;
+    return first;
+}
+
+void PairingHeap::push(int vertex, int key) {
+    if(vertex >= (int)this->keys.size()) {
+        this->keys.resize(vertex + 1);
+        this->child.resize(vertex + 1);
+        this->sibling.resize(vertex + 1);
+        this->previous.resize(vertex + 1);
+    }
+    this->keys[vertex] = key;
+    this->child[vertex] = -1;
+    this->sibling[vertex] = -1;
+    this->previous[vertex] = -1;
+    this->root = this->meld(this->root, vertex);
+}
+
+void PairingHeap::decrease(int vertex, int key) {
+    this->keys[vertex] = key;
+    if(vertex == this->root) {
+        return;
+    }
+    //  cut the subtree of vertex out of the list of its siblings
+    int left = this->previous[vertex];
+    if(this->child[left] == vertex) {
+        this->child[left] = this->sibling[vertex];
+    } else {
+        this->sibling[left] = this->sibling[vertex];
+    }
+    if(this->sibling[vertex] != -1) {
+        this->previous[this->sibling[vertex]] = left;
+    }
+    this->sibling[vertex] = -1;
+    this->previous[vertex] = -1;
+    this->root = this->meld(this->root, vertex);
+}
+
+int PairingHeap::pop() {
+    int vertex = this->root;
+    this->pairs.clear();
+    int current = this->child[vertex];
+    while(current != -1) {
+        int first = current;
+        int second = this->sibling[first];
+        if(second == -1) {
+            this->previous[first] = -1;
+            this->pairs.push_back(first);
+            break;
+        }
+        current = this->sibling[second];
+        this->pairs.push_back(this->meld(first, second));
+    }
+    int newRoot = -1;
+    for(int i = (int)this->pairs.size() - 1; i >= 0; i--) {
+        newRoot = this->meld(this->pairs[i], newRoot);
+    }
+    this->root = newRoot;
+    return vertex;
+}
+
+RadixHeap::RadixHeap() {
+    this->last = 0;
+    this->count = 0;
+}
+
+int RadixHeap::bucketOf(uint32_t key, uint32_t last) {
+    uint32_t difference = key ^ last;
+    if(difference == 0) {
+        return 0;
+    }
+#if defined(__GNUC__)
+    return 32 - __builtin_clz(difference);
+#else
+    int bits = 0;
+    for(; difference != 0; difference >>= 1) {
+        bits++;
+    }
+    return bits;
+#endif
+}
+
+void RadixHeap::clear() {
+    for(auto & bucket : this->buckets) {
+        bucket.clear();
+    }
+    this->last = 0;
+    this->count = 0;
+}
+
+bool RadixHeap::empty() const {
+    return this->count == 0;
+}
+
+void RadixHeap::push(int vertex, int key) {
+    this->buckets[bucketOf((uint32_t)key, this->last)].emplace_back((uint32_t)key, vertex);
+    this->count++;
+}
+
+void RadixHeap::decrease(int vertex, int key) {
+    this->push(vertex, key);        //  the old entry stays in its bucket and is skipped later
+}
+
+int RadixHeap::pop() {
+    if(this->buckets[0].empty()) {
+        int i = 1;
+        while(this->buckets[i].empty()) {
+            i++;
+        }
+        //  the smallest key of the first non-empty bucket becomes last, its keys all fall into lower buckets then
+        auto& bucket = this->buckets[i];
+        uint32_t minimum = UINT32_MAX;
+        for(auto & entry : bucket) {
+            minimum = std::min(minimum, entry.first);
+        }
+        this->last = minimum;
+        for(auto & entry : bucket) {
+            this->buckets[bucketOf(entry.first, this->last)].push_back(entry);
+        }
+        bucket.clear();
+    }
+    int vertex = this->buckets[0].back().second;
+    this->buckets[0].pop_back();
+    this->count--;
+    return vertex;
+}
+
+void DijkstraWorkspace::prepare(int vertexCount) {
+    if((int)this->distances.size() != vertexCount) {
+        this->distances.assign(vertexCount, INT_MAX);
+        this->parents.assign(vertexCount, -1);
+        this->settled.assign(vertexCount, false);
+    } else {
+        for(int vertex : this->touched) {
+            this->distances[vertex] = INT_MAX;
+            this->parents[vertex] = -1;
+            this->settled[vertex] = false;
+        }
+    }
+    this->touched.clear();
+    this->binaryHeap.clear();
+    this->fourAryHeap.clear();
+    this->pairingHeap.clear();
+    this->radixHeap.clear();
+}
+
+void DijkstraWorkspace::reach(int vertex) {
+    this->touched.push_back(vertex);
+}
+
+void DijkstraWorkspace::settle(int vertex) {
+    this->settled[vertex] = true;
+}
+
+bool DijkstraWorkspace::isSettled(int vertex) const {
+    return this->settled[vertex];
+}
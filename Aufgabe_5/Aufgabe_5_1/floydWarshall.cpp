@@ -0,0 +1,225 @@
+#include "floydWarshall.h"
+#include <algorithm>
+#include <atomic>
+#include <climits>
+#include <condition_variable>
+#include <future>
+#include <mutex>
+#include <thread>
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+/*  --
+    One row of the min-plus product: row[j] = min(row[j], viaDistance + rowK[j]), and nextRow[j] = viaHop where
+    it got smaller. Both summands are between 0 and INT_MAX, so a sum that does not fit into an int wraps around
+    to a negative number and is left out: that is the saturating addition, INT_MAX + x stays "no path".
+--  */
+static void minPlusRow(int* row, int* nextRow, const int* rowK, int viaDistance, int viaHop, int count) {
+    int j = 0;
+#if defined(__SSE2__)
+    const __m128i via = _mm_set1_epi32(viaDistance);
+    const __m128i hop = _mm_set1_epi32(viaHop);
+    const __m128i zero = _mm_setzero_si128();
+    for(; j + 4 <= count; j += 4) {
+        __m128i current = _mm_loadu_si128((const __m128i*)(row + j));
+        __m128i sum = _mm_add_epi32(via, _mm_loadu_si128((const __m128i*)(rowK + j)));
+        //  better = sum < current and sum >= 0
+        __m128i better = _mm_andnot_si128(_mm_cmplt_epi32(sum, zero), _mm_cmplt_epi32(sum, current));
+        __m128i next = _mm_loadu_si128((const __m128i*)(nextRow + j));
+        _mm_storeu_si128((__m128i*)(row + j), _mm_or_si128(_mm_and_si128(better, sum), _mm_andnot_si128(better, current)));
+        _mm_storeu_si128((__m128i*)(nextRow + j), _mm_or_si128(_mm_and_si128(better, hop), _mm_andnot_si128(better, next)));
+    }
+#endif
+    for(; j < count; j++) {
+        int sum = (int)((unsigned int)viaDistance + (unsigned int)rowK[j]);
+        if(sum >= 0 && sum < row[j]) {
+            row[j] = sum;
+            nextRow[j] = viaHop;
+        }
+    }
+}
+
+AllPairsPaths::AllPairsPaths() {
+    this->vertexCount = 0;
+    this->stride = 0;
+}
+
+int AllPairsPaths::getVertexCount() const {
+    return this->vertexCount;
+}
+
+int AllPairsPaths::distance(int source, int target) const {
+    return this->distances[(size_t)source * this->stride + target];
+}
+
+int AllPairsPaths::nextHop(int source, int target) const {
+    return this->nextHops[(size_t)source * this->stride + target];
+}
+
+std::vector<int> AllPairsPaths::path(int source, int target) const {
+    std::vector<int> result;
+    if(this->nextHop(source, target) == -1) {
+        return result;
+    }
+    result.push_back(source);
+    for(int vertex = source; vertex != target; ) {
+        vertex = this->nextHop(vertex, target);
+        result.push_back(vertex);
+    }
+    return result;
+}
+
+//  all k of block k for the rows of rowBlock and the columns of columnBlock
+void AllPairsPaths::relaxBlock(int rowBlock, int columnBlock, int k) {
+    int* distances = this->distances.data();
+    int* nextHops = this->nextHops.data();
+    size_t stride = (size_t)this->stride;
+    int firstColumn = columnBlock * blockSize;
+    for(int via = k * blockSize; via < (k + 1) * blockSize; via++) {
+        const int* rowK = distances + via * stride + firstColumn;
+        for(int i = rowBlock * blockSize; i < (rowBlock + 1) * blockSize; i++) {
+            int viaDistance = distances[i * stride + via];
+            if(viaDistance == INT_MAX) {
+                continue;
+            }
+            minPlusRow(distances + i * stride + firstColumn, nextHops + i * stride + firstColumn, rowK,
+                       viaDistance, nextHops[i * stride + via], blockSize);
+        }
+    }
+}
+
+/*  --
+    Barrier for a fixed number of threads: wait() returns once all of them called it. The generation tells a thread
+    that woke up whether its round is over, so the barrier can be used again right away for the next phase.
+--  */
+class PhaseBarrier {
+    public:
+        explicit PhaseBarrier(int threadCount) {
+            this->threadCount = threadCount;
+            this->waiting = 0;
+            this->generation = 0;
+        }
+
+        void wait() {
+            std::unique_lock<std::mutex> lock(this->mutex);
+            int round = this->generation;
+            if(++this->waiting == this->threadCount) {
+                this->waiting = 0;
+                this->generation++;
+                this->allArrived.notify_all();
+                return;
+            }
+            this->allArrived.wait(lock, [this, round]() { return this->generation != round; });
+        }
+
+    private:
+        std::mutex mutex;
+        std::condition_variable allArrived;
+        int threadCount;
+        int waiting;
+        int generation;
+};
+
+void AllPairsPaths::compute(const std::vector<int>& weights, int vertexCount) {
+    this->vertexCount = vertexCount;
+    int blockCount = (vertexCount + blockSize - 1) / blockSize;
+    this->stride = blockCount * blockSize;
+    size_t stride = (size_t)this->stride;
+
+    //  the padding vertices have no edges and do not change any distance
+    this->distances.assign(stride * stride, INT_MAX);
+    this->nextHops.assign(stride * stride, -1);
+    bool zeroWeights = false;
+    for(int i = 0; i < vertexCount; i++) {
+        for(int j = 0; j < vertexCount; j++) {
+            int weight = weights[(size_t)i * vertexCount + j];
+            zeroWeights = zeroWeights || (weight == 0 && i != j);
+            if(weight != INT_MAX) {
+                this->distances[i * stride + j] = weight;
+                this->nextHops[i * stride + j] = j;
+            }
+        }
+    }
+    for(int i = 0; i < this->stride; i++) {
+        this->distances[i * stride + i] = 0;
+        this->nextHops[i * stride + i] = i;
+    }
+
+    /*  --
+        The threads are started once and go through all phases together, the barrier separates the phases. The
+        calling thread relaxes the diagonal block and resets the counters the others take their blocks from.
+    --  */
+    int others = blockCount - 1;
+    //  no more threads than blocks in the largest phase
+    int threadCount = (int)std::min<long long>(std::max(1u, std::thread::hardware_concurrency()),
+                                               std::max({1LL, 2LL * others, (long long)others * others}));
+    PhaseBarrier barrier(threadCount);
+    std::atomic<int> nextCross(0);
+    std::atomic<int> nextRest(0);
+    auto work = [this, blockCount, others, &barrier, &nextCross, &nextRest](bool caller) {
+        for(int k = 0; k < blockCount; k++) {
+            if(caller) {
+                this->relaxBlock(k, k, k);
+                nextCross = 0;
+                nextRest = 0;
+            }
+            barrier.wait();
+            //  block b of row k for even b, of column k for odd b; other skips k
+            for(int b = nextCross++; b < 2 * others; b = nextCross++) {
+                int other = b / 2 < k ? b / 2 : b / 2 + 1;
+                if(b % 2 == 0) {
+                    this->relaxBlock(k, other, k);
+                } else {
+                    this->relaxBlock(other, k, k);
+                }
+            }
+            barrier.wait();
+            for(int b = nextRest++; b < others * others; b = nextRest++) {
+                int i = b / others;
+                int j = b % others;
+                this->relaxBlock(i < k ? i : i + 1, j < k ? j : j + 1, k);
+            }
+            barrier.wait();
+        }
+    };
+    std::vector<std::future<void>> helpers;
+    for(int t = 1; t < threadCount; t++) {
+        helpers.push_back(std::async(std::launch::async, work, false));
+    }
+    work(true);
+    for(auto & helper : helpers) {
+        helper.get();
+    }
+    if(zeroWeights) {
+        this->repairNextHops(weights);
+    }
+}
+
+void AllPairsPaths::repairNextHops(const std::vector<int>& weights) {
+    //  breadth-first from every target backwards over the edges u -> v with weight + distance(v) == distance(u)
+    int n = this->vertexCount;
+    size_t stride = (size_t)this->stride;
+    std::vector<bool> reached(n);
+    std::vector<int> queue;
+    for(int target = 0; target < n; target++) {
+        std::fill(reached.begin(), reached.end(), false);
+        queue.assign(1, target);
+        reached[target] = true;
+        for(size_t head = 0; head < queue.size(); head++) {
+            int v = queue[head];
+            long long distanceV = this->distances[v * stride + target];
+            for(int u = 0; u < n; u++) {
+                int weight = weights[(size_t)u * n + v];
+                if(reached[u] || weight == INT_MAX || u == v) {
+                    continue;
+                }
+                if(weight + distanceV == this->distances[u * stride + target]) {
+                    this->nextHops[u * stride + target] = v;
+                    reached[u] = true;
+                    queue.push_back(u);
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,43 @@
+#ifndef AUFGABE_5_1_FLOYDWARSHALL_H
+#define AUFGABE_5_1_FLOYDWARSHALL_H
+
+#include <vector>
+
+/*  --
+    Distances and next hops between all pairs of vertices, filled by Graph::performFloydWarshall.
+    compute() runs Floyd-Warshall on a flat row-major copy of the weights in blocks of blockSize x blockSize:
+    for every block k the diagonal block first, then the blocks in row and column k, then all the others. The
+    blocks of one phase only read the finished blocks of row and column k, so they run on different threads; the
+    threads are started once per compute() and meet at a barrier between the phases. The three blocks a block update reads (3 x 16 KiB) stay in the cache, and their rows are combined with SSE2
+    min-plus operations where the compiler targets SSE2 (every x86-64), with a plain loop otherwise.
+    INT_MAX stands for "no path"; a sum is only taken if it did not overflow, so INT_MAX never becomes a
+    distance. The weights must not be negative.
+    With positive weights the next hops lead to the target on a shortest path. Blocks read distances that already
+    use later vertices of block k, so with weight 0 edges (a zero cycle, since the edges of Graph are undirected)
+    next hops could point back and forth; in that case they are rebuilt afterwards, O(V^3) once more.
+--  */
+class AllPairsPaths {
+    public:
+        static const int blockSize = 64;
+
+        AllPairsPaths();
+
+        //  weights[i * vertexCount + j]: weight of the edge i -> j, INT_MAX if there is none
+        void compute(const std::vector<int>& weights, int vertexCount);
+
+        int getVertexCount() const;
+        int distance(int source, int target) const;         //  INT_MAX if target can not be reached
+        int nextHop(int source, int target) const;          //  vertex after source on the path, -1 if there is none
+        std::vector<int> path(int source, int target) const;    //  source ... target, empty if unreachable
+
+    private:
+        int vertexCount;
+        int stride;                                         //  vertexCount rounded up to a multiple of blockSize
+        std::vector<int> distances;                         //  stride x stride, row-major
+        std::vector<int> nextHops;
+
+        void relaxBlock(int rowBlock, int columnBlock, int k);
+        void repairNextHops(const std::vector<int>& weights);
+};
+
+#endif //AUFGABE_5_1_FLOYDWARSHALL_H
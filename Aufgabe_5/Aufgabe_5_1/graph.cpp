@@ -1,4 +1,10 @@
 #include "graph.h"
+#include <atomic>   /*  atomic distances of performDeltaStepping  */
+#include <future>
+#include <memory>
+#include <functional>
+#include <queue>    /*  non-empty buckets of performDeltaStepping  */
+#include <thread>
 
 
 Graph::Graph() {                                            //  Default Constructor
@@ -9,14 +15,140 @@ Graph::Graph() {                                            //  Default Construc
 /*  --
     Constructor with params
 --  */
-Graph::Graph(const std::vector<std::string>& vertices, const std::vector<Edge>& edges) {
+Graph::Graph(const std::vector<std::string>& vertices, const std::vector<Edge>& edges, Storage storage) {
     this->vertices = vertices;                                                                  //  definition of this->vertex through parameter vertices (type: std::vector<std::string>)
+    this->storage = storage;
+    this->rebuildVertexIds();                   //  every name is hashed once, the edges below only look them up
+    if(storage == Storage::CSR) {
+        this->buildCSR(edges);                  //  all edges at once, O(V+E)
+        return;
+    }
     this->adjacencyMatrix.resize((int)vertices.size(), std::vector<int>((int)this->vertices.size(), INT_MAX));     //  creation of an NxN Matrix, based on the size of vertices
     for(int i = 0; i < edges.size(); i++) {
         insertEdge(edges[i]);                   //  edges are added one by one, utilizing the insertEdge()-Function
     }
 }
 
+/*  --  /
+Function that fills offsets, targets and weights from a list of edges;
+    - every edge is stored in both directions, like insertEdge does
+    - counts the edges per vertex first, so every edge is copied straight to its final row
+    - rows are sorted by target; if an edge is given twice the last one wins and INT_MAX means no edge,
+      like calling insertEdge for every edge of the matrix
+/   --  */
+void Graph::buildCSR(const std::vector<Edge>& edges) {
+    int vertexCount = (int)this->vertices.size();
+    std::vector<int> sources;
+    std::vector<std::pair<int, int>> entries;                   //  (target, weight) in the order of edges
+    sources.reserve(2 * edges.size());
+    entries.reserve(2 * edges.size());
+    this->offsets.assign(vertexCount + 1, 0);
+
+    for(const auto & edge : edges) {
+        int source = this->resolveVertex(edge.getSrc());
+        int target = this->resolveVertex(edge.getDest());
+        if(source == -1 || target == -1) {
+            std::cerr << "Vertex not found!\n";
+            continue;
+        }
+        sources.push_back(source);
+        entries.emplace_back(target, edge.weight);
+        sources.push_back(target);
+        entries.emplace_back(source, edge.weight);
+        this->offsets[source + 1]++;
+        this->offsets[target + 1]++;
+    }
+    for(int u = 0; u < vertexCount; u++) {
+        this->offsets[u + 1] += this->offsets[u];                //  prefix sums: offsets[u] is the first position of row u
+    }
+
+    std::vector<std::pair<int, int>> rows(entries.size());
+    std::vector<int> cursor(this->offsets.begin(), this->offsets.end() - 1);
+    for(size_t e = 0; e < entries.size(); e++) {
+        rows[cursor[sources[e]]++] = entries[e];
+    }
+
+    this->targets.clear();
+    this->weights.clear();
+    this->targets.reserve(rows.size());
+    this->weights.reserve(rows.size());
+    int begin = 0;
+    for(int u = 0; u < vertexCount; u++) {
+        int end = this->offsets[u + 1];
+        std::stable_sort(rows.begin() + begin, rows.begin() + end,
+                         [](const std::pair<int, int>& a, const std::pair<int, int>& b) { return a.first < b.first; });
+        this->offsets[u] = (int)this->targets.size();
+        for(int e = begin; e < end; e++) {
+            if(e + 1 < end && rows[e + 1].first == rows[e].first) {
+                continue;                                       //  a later edge to the same target overwrites this one
+            }
+            if(rows[e].second != INT_MAX) {
+                this->targets.push_back(rows[e].first);
+                this->weights.push_back(rows[e].second);
+            }
+        }
+        begin = end;
+    }
+    this->offsets[vertexCount] = (int)this->targets.size();
+}
+
+int Graph::findEdge(int source, int target) const {
+    auto first = this->targets.begin() + this->offsets[source];
+    auto last = this->targets.begin() + this->offsets[source + 1];
+    auto found = std::lower_bound(first, last, target);
+    if(found == last || *found != target) {
+        return -1;
+    }
+    return (int)(found - this->targets.begin());
+}
+
+int Graph::edgeWeight(int source, int target) const {
+    if(this->storage == Storage::Matrix) {
+        return this->adjacencyMatrix[source][target];
+    }
+    int e = this->findEdge(source, target);
+    return e == -1 ? INT_MAX : this->weights[e];
+}
+
+/*  --  /
+Function that sets the weight of the edge source -> target in the current storage;
+in CSR the following rows move by one position when an edge is added or removed, O(V+E)
+/   --  */
+void Graph::setEdge(int source, int target, int weight) {
+    if(this->storage == Storage::Matrix) {
+        this->adjacencyMatrix[source][target] = weight;
+        return;
+    }
+    int e = this->findEdge(source, target);
+    if(e != -1 && weight != INT_MAX) {
+        this->weights[e] = weight;
+        return;
+    }
+    if(e == -1 && weight == INT_MAX) {
+        return;
+    }
+    if(e != -1) {
+        this->targets.erase(this->targets.begin() + e);
+        this->weights.erase(this->weights.begin() + e);
+        for(int u = source + 1; u < (int)this->offsets.size(); u++) {
+            this->offsets[u]--;
+        }
+        return;
+    }
+    auto first = this->targets.begin() + this->offsets[source];
+    auto last = this->targets.begin() + this->offsets[source + 1];
+    auto position = std::lower_bound(first, last, target) - this->targets.begin();
+    this->targets.insert(this->targets.begin() + position, target);
+    this->weights.insert(this->weights.begin() + position, weight);
+    for(int u = source + 1; u < (int)this->offsets.size(); u++) {
+        this->offsets[u]++;
+    }
+}
+
+Graph::Storage Graph::getStorage() const {
+    return this->storage;
+}
+
 /*  --  /
 Function to insert a vertex into the Graph;
     - takes one argument of type std::string that represents a vertex
@@ -27,11 +159,16 @@ void Graph::insertVertex(const std::string& vertex) {
         std::cerr << "Vertex already in Graph!\n";  /*  Calls this->resolveVertex to check if a given vertex is already in the Graph. Returns with an error, if this is the case.   */
         return;                                     /*  --  */
     }
+    this->vertexIds.emplace(vertex, (int)this->vertices.size());    //  the new vertex gets the next free index
     this->vertices.push_back(vertex);               //  adds a vertetx via the push_back function provided by std::vector
-    this->adjacencyMatrix.resize(this->vertices.size(), std::vector<int>(this->vertices.size()));   //  resizes the adjacencyMatrix to the new size
-    for(int i = 0; i < this->vertices.size(); i++) {        /*  --  */
-        adjacencyMatrix[i].resize(this->vertices.size());   /*  resizes every "sub" vector of the matrix to the new size    */
-    }                                                       /*  --  */
+    if(this->storage == Storage::CSR) {
+        this->offsets.push_back(this->offsets.back());      //  new empty row at the end
+        return;
+    }
+    this->adjacencyMatrix.resize(this->vertices.size(), std::vector<int>(this->vertices.size(), INT_MAX));   //  resizes the adjacencyMatrix to the new size
+    for(int i = 0; i < this->vertices.size(); i++) {                /*  --  */
+        adjacencyMatrix[i].resize(this->vertices.size(), INT_MAX);  /*  resizes every "sub" vector of the matrix to the new size, without edges to the new vertex    */
+    }                                                               /*  --  */
 }
 
 /*  --  /
@@ -40,15 +177,42 @@ Function to delete a vertex from the Graph;
     - returns void
 /   --  */
 void Graph::deleteVertex(const std::string& vertex) {
-    int index = this->resolveVertex(vertex);
-    if(index == -1) {                               /*  --  */
-        std::cerr << "Vertex not found\n";          /*  Calls this->resolveVertex to check if a given vertex is already in the Graph. Returns with an error, if this is the case.   */
+    this->deleteVertex(this->resolveVertex(vertex));
+}
+
+void Graph::deleteVertex(int index) {
+    if(!this->validVertex(index)) {                 /*  --  */
+        std::cerr << "Vertex not found\n";          /*  Calls this->validVertex to check if a given vertex is in the Graph. Returns with an error, if this is not the case.   */
         return;                                     /*  --  */
     }
     this->vertices.erase(this->vertices.begin() + index);   //  erases the vertex at position "index" from this->vertices
+    this->rebuildVertexIds();                               //  all following vertices moved down by one
+
+    if(this->storage == Storage::CSR) {
+        //  rows behind index move up by one, edges to index are dropped and targets behind it are renumbered
+        std::vector<int> newOffsets(1, 0);
+        std::vector<int> newTargets;
+        std::vector<int> newWeights;
+        for(int u = 0; u + 1 < (int)this->offsets.size(); u++) {
+            if(u == index) {
+                continue;
+            }
+            for(int e = this->offsets[u]; e < this->offsets[u + 1]; e++) {
+                if(this->targets[e] != index) {
+                    newTargets.push_back(this->targets[e] > index ? this->targets[e] - 1 : this->targets[e]);
+                    newWeights.push_back(this->weights[e]);
+                }
+            }
+            newOffsets.push_back((int)newTargets.size());
+        }
+        this->offsets.swap(newOffsets);
+        this->targets.swap(newTargets);
+        this->weights.swap(newWeights);
+        return;
+    }
 
     this->adjacencyMatrix.erase(this->adjacencyMatrix.begin() + index);             //  erases the entries from the adjacencyMatrix at "column" position "index"
-    for(int i = 0; i < this->adjacencyMatrix[0].size(); i ++) {                     /*  --  */
+    for(int i = 0; i < this->adjacencyMatrix.size(); i ++) {                        /*  --  */
         this->adjacencyMatrix[i].erase(this->adjacencyMatrix[i].begin() + index);   /*  erases the entries from the adjacencyMatrix in every "row" */
     }                                                                               /*  --  */
 }
@@ -62,13 +226,17 @@ Function to insert an Edge
 void Graph::insertEdge(const Edge& edge) {
     int col = this->resolveVertex(edge.getSrc());        //  resolves the src of the edge to the index within the adjacencyMatrix
     int row = this->resolveVertex(edge.getDest());       //  resolves the dest of the edge to the index within the adjacencyMatrix
-    if(col == -1 || row == -1) {                    /*  --  */
-        std::cerr << "Vertex not found!\n";         /*  Calls this->resolveVertex to check if a given vertex is already in the Graph. Returns with an error, if this is the case.   */
+    this->insertEdge(col, row, edge.weight);
+}
+
+void Graph::insertEdge(int col, int row, int weight) {
+    if(!this->validVertex(col) || !this->validVertex(row)) {   /*  --  */
+        std::cerr << "Vertex not found!\n";         /*  Returns with an error, if one of the vertices is not in the Graph.   */
         return;                                     /*  --  */
     }
     
-    this->adjacencyMatrix[col][row]= edge.weight;   //  sets the value of the adjacencyMatrix at position [col][row] to the weight of the edge
-    this->adjacencyMatrix[row][col]= edge.weight;   //  sets the value of the adjacencyMatrix at position [col][row] to the weight of the edge
+    this->setEdge(col, row, weight);                //  sets the value of the adjacencyMatrix at position [col][row] to the weight of the edge
+    this->setEdge(row, col, weight);                //  sets the value of the adjacencyMatrix at position [row][col] to the weight of the edge
   }
 
 /*  --  /
@@ -79,11 +247,16 @@ Function to delete an Edge
 void Graph::deleteEdge(const Edge& edge) {                 
     int col = this->resolveVertex(edge.getSrc());        //  resolves the src of the edge to the index within the adjacencyMatrix
     int row = this->resolveVertex(edge.getDest());       //  resolves the dest of the edge to the index within the adjacencyMatrix
-    if(col == -1 || row == -1) {                    /*  --  */
-        std::cerr << "Vertex not found!\n";         /*  Calls this->resolveVertex to check if a given vertex is already in the Graph. Returns with an error, if this is the case.   */
+    this->deleteEdge(col, row);
+}
+
+void Graph::deleteEdge(int col, int row) {
+    if(!this->validVertex(col) || !this->validVertex(row)) {   /*  --  */
+        std::cerr << "Vertex not found!\n";         /*  Returns with an error, if one of the vertices is not in the Graph.   */
         return;                                     /*  --  */
     }
-    this->adjacencyMatrix[col][row]= 0;             //  sets the value of the adjacencyMatrix at position [col][row] to 0
+    this->setEdge(col, row, INT_MAX);               //  sets the value of the adjacencyMatrix at position [col][row] to INT_MAX ("no edge")...
+    this->setEdge(row, col, INT_MAX);               //  ...and at [row][col], as insertEdge set both directions
 }
 
 /*  --  /
@@ -92,16 +265,18 @@ Function to check whether vertex v2 is adjacent to vertex v1
     - returns void
 /   --  */
 bool Graph::adjacent(const std::string& vertex1, const std::string& vertex2) {
-    int indexVertex1 = this->resolveVertex(vertex1);
-    int indexVertex2 = this->resolveVertex(vertex2);
-    if(indexVertex1 == -1 || indexVertex2 == -1) {
+    return this->adjacent(this->resolveVertex(vertex1), this->resolveVertex(vertex2));
+}
+
+bool Graph::adjacent(int indexVertex1, int indexVertex2) {
+    if(!this->validVertex(indexVertex1) || !this->validVertex(indexVertex2)) {
         std::cerr << "Vertex not found!\n";
         return false;
     }
     //  As adjacency is an equivalency relation, we need to check for a possible relation in both direction.
     //  This can be achieved by swapping the the position specifications of the adjacencyMatrix (from [indexVertex1][indexVertex2]
     //  to [indexVertex2][indexVertex1]).
-    if(this->adjacencyMatrix[indexVertex1][indexVertex2] != 0 || this->adjacencyMatrix[indexVertex2][indexVertex1] != 0) {
+    if(this->edgeWeight(indexVertex1, indexVertex2) != INT_MAX || this->edgeWeight(indexVertex2, indexVertex1) != INT_MAX) {
         return true;    //  if a connection (in any direction) is found, return true
     } else {
         return false;   //  else, return false
@@ -116,13 +291,22 @@ this does not automatically imply that "B" is the neighbour of "A".
     - returns a std::vector of std::string
 /   --  */
 std::vector<std::string> Graph::neighbours(const std::string& vertex) {
-    int indexVertex = this->resolveVertex(vertex);                          //  resolves the vertex to the index within the adjacencyMatrix
     std::vector<std::string> resVector = {};                                //  initializes an empty std::vetor of std::string
-    for(int i = 0; i < this->adjacencyMatrix[indexVertex].size(); i++) {    /*  Loops through all entries of the subvector of adjacencyMatrix[indexVertex] */
-        if(this->adjacencyMatrix[indexVertex][i] != 0) {                    /*  and checks if  the entry at position [indexVertex][i] is not 0. */
-            resVector.push_back(this->vertices[i]);                         /*  If the condition is fulfilled, add the vertex (name) to the result vector resVector */
-        }
+    for(int i : this->neighbours(this->resolveVertex(vertex))) {            /*  Loops through the indices of all neighbours */
+        resVector.push_back(this->vertices[i]);                             /*  and adds the vertex (name) to the result vector resVector */
+    }
+    return resVector;
+}
+
+std::vector<int> Graph::neighbours(int indexVertex) {
+    std::vector<int> resVector = {};                                        //  initializes an empty std::vetor of int
+    if(!this->validVertex(indexVertex)) {
+        std::cerr << "Vertex not found!\n";
+        return resVector;
     }
+    this->forEachEdge(indexVertex, [&resVector](int target, int) {          /*  Loops through all edges of indexVertex (entries != INT_MAX) */
+        resVector.push_back(target);                                        /*  and adds the index of their target to the result vector resVector */
+    });
     return resVector;
 }
 
@@ -141,7 +325,7 @@ void Graph::printGraph() {
     for(int i=0; i < this->vertices.size(); i++) {
         std::cout << this->vertices[i] << "\t-->\t";
         for (int j = 0; j < this->vertices.size(); j++) {
-            std::cout << this->adjacencyMatrix[i][j] << "\t";
+            std::cout << this->edgeWeight(i, j) << "\t";
         }
         std::cout << "\n";
     }
@@ -156,12 +340,35 @@ between vertices of type std::string and the corresponding index (in the adjacen
     - function returns -1 in case the resolution of the name is unsuccessful
 /   --  */
 int Graph::resolveVertex(const std::string& vertexName) {
-    for(int i = 0; i < this->vertices.size(); i++) {
-        if(this->vertices[i] == vertexName) {
-            return i;
-        }
+    auto found = this->vertexIds.find(vertexName);
+    if(found == this->vertexIds.end()) {
+        return -1;
+    }
+    return found->second;
+}
+
+/*  --  /
+Function that hashes all names of this->vertices again; a name that occurs twice resolves to its first index,
+like the linear search did before.
+/   --  */
+void Graph::rebuildVertexIds() {
+    this->vertexIds.clear();
+    this->vertexIds.reserve(this->vertices.size());
+    for(int i = 0; i < (int)this->vertices.size(); i++) {
+        this->vertexIds.emplace(this->vertices[i], i);
     }
-    return -1;
+}
+
+bool Graph::validVertex(int vertex) const {
+    return vertex >= 0 && vertex < (int)this->vertices.size();
+}
+
+const std::string& Graph::getVertexName(int vertex) const {
+    return this->vertices.at(vertex);
+}
+
+int Graph::getVertexCount() const {
+    return (int)this->vertices.size();
 }
 
 /*  Public implementation of the travelling salesman's algorithm
@@ -173,74 +380,339 @@ int Graph::resolveVertex(const std::string& vertexName) {
     - This "convenience" function increases efficiency of use and reduces error-proneness
 */
 void Graph::letTheSalesmanTravel(const std::string& vertex) {
-    int vertexIndex = this->resolveVertex(vertex);
-    if(vertexIndex == -1) {                     //  Error-Handling in case the vertex could not be resolved
+    this->letTheSalesmanTravel(this->resolveVertex(vertex));
+}
+
+void Graph::letTheSalesmanTravel(int vertexIndex) {
+    if(!this->validVertex(vertexIndex)) {       //  Error-Handling in case the vertex could not be resolved
         std::cerr << "Vertex not found!\n";
         exit(1);
     }
-    std::cout << vertex;                            //  Outputs the first vertex
+    std::cout << this->vertices[vertexIndex];       //  Outputs the first vertex
     std::vector<bool> visited;                      //  declaration...
     visited.resize(this->vertices.size(), false);   //  ...and initialization of the "visited" vector
     visited[vertexIndex] = true;                    //  every entry of visited is false, except the vertex that has been passed to the function
-    this->_letTheSalesmanTravel(vertex, visited, vertex);   //  call the private implementation for the travelling salesman's algorithm
+    this->_letTheSalesmanTravel(vertexIndex, visited, vertexIndex);   //  call the private implementation for the travelling salesman's algorithm
 }
 
 
 
 
 int* Graph::performDijkstra(const std::string& sourceVertex){
-    std::stringstream retString;                        //  stringstream variable to concat output
-    int src = this->resolveVertex(sourceVertex);        //  resolve vertexName of sourceVertex to indicies in the matrix
-    if(src == -1 ) {                                     /*  --  */
+    return this->performDijkstra(this->resolveVertex(sourceVertex));    //  resolve vertexName of sourceVertex to indicies in the matrix
+}
+
+int* Graph::performDijkstra(int src){
+    if(!this->validVertex(src)) {                        /*  --  */
         std::cerr << "Vertex not found!\n";             /*  If src is -1 (not in this->vertices), return function with error warning   */
         return new int(-1);                   /*  --  */
     }
-    bool visited[(int)this->vertices.size()];                //  Declare an array of bool with the size of this->vertices.size() to remember which vertices have already been visited
+    this->performDijkstra(src, this->workspace);         //  distances end up in this->workspace
     int* distances = (int*)malloc((int)this->vertices.size() * sizeof(int));            //  Declare an array of int with the size of this->vertices.size() for the distance metrics
+    std::copy(this->workspace.distances.begin(), this->workspace.distances.end(), distances);   //  INT_MAX is our way of defining the value "INFINITY"
+    return distances;
+}
 
-    for(int i = 0; i < (int)this->vertices.size(); i++) {
-        visited[i] = false;                             //  every entry of visited is set to false
-        distances[i] = INT_MAX;                         //  every entry of distances is set to INT_MAX (this is our way of defining the value "INFINITY")
+/*  --  /
+The Dijkstra algorithm for one kind of priority queue;
+    - every vertex is taken out of the queue once with its final distance (settled), later entries of the same
+      vertex in BinaryHeap/RadixHeap are skipped
+    - a vertex reached for the first time is pushed, a shorter path to a vertex in the queue decreases its key
+/   --  */
+template<typename Heap>
+void Graph::runDijkstra(int source, int target, DijkstraWorkspace& workspace, Heap& heap) const {
+    std::vector<int>& distances = workspace.distances;
+    std::vector<int>& parents = workspace.parents;
+
+    distances[source] = 0;
+    workspace.reach(source);
+    heap.push(source, 0);
+
+    while(!heap.empty()) {
+        int u = heap.pop();
+        if(workspace.isSettled(u)) {
+            continue;
+        }
+        workspace.settle(u);
+        if(u == target) {
+            return;
+        }
+        this->forEachEdge(u, [&](int v, int weight) {
+            if(workspace.isSettled(v)) {
+                return;
+            }
+            int distance = distances[u] + weight;
+            if(distances[v] == INT_MAX) {
+                distances[v] = distance;
+                parents[v] = u;
+                workspace.reach(v);
+                heap.push(v, distance);
+            } else if(distance < distances[v]) {
+                distances[v] = distance;
+                parents[v] = u;
+                heap.decrease(v, distance);
+            }
+        });
+    }
+}
+
+void Graph::performDijkstra(int src, DijkstraWorkspace& workspace, DijkstraHeap heap, int target) const {
+    workspace.prepare((int)this->vertices.size());
+    if(!this->validVertex(src) || (target != -1 && !this->validVertex(target))) {
+        std::cerr << "Vertex not found!\n";
+        return;
+    }
+    switch(heap) {
+        case DijkstraHeap::Binary:
+            this->runDijkstra(src, target, workspace, workspace.binaryHeap);
+            break;
+        case DijkstraHeap::FourAry:
+            this->runDijkstra(src, target, workspace, workspace.fourAryHeap);
+            break;
+        case DijkstraHeap::Pairing:
+            this->runDijkstra(src, target, workspace, workspace.pairingHeap);
+            break;
+        case DijkstraHeap::Radix:
+            this->runDijkstra(src, target, workspace, workspace.radixHeap);
+            break;
     }
+}
 
-    distances[src] = 0;                                 // sets the distance of the source to 0, as a vertex can not have a distance to itself
+void Graph::performFloydWarshall(AllPairsPaths& paths) const {
+    //  flat row-major copy of the adjacencyMatrix (or of the CSR edges), INT_MAX where there is no edge
+    int vertexCount = (int)this->vertices.size();
+    std::vector<int> flat((size_t)vertexCount * vertexCount, INT_MAX);
+    for(int u = 0; u < vertexCount; u++) {
+        this->forEachEdge(u, [&flat, u, vertexCount](int v, int weight) {
+            flat[(size_t)u * vertexCount + v] = std::min(flat[(size_t)u * vertexCount + v], weight);
+        });
+    }
+    paths.compute(flat, vertexCount);
+}
 
-    for(int j = 0; j < (int)this->vertices.size(); j++) {
-        int u;                                          //  declaration of int u; will represent our "minimum" element
-        int minDist = INT_MAX;                          //  set minDist to INT_MAX, so that the following check does not run into an unexpected error with longer distances
+//  buckets with fewer vertices are relaxed on the calling thread, starting threads would cost more than they save
+static const int parallelFrontierCutoff = 1024;
+//  delta is raised if the heaviest edge would need more buckets than this
+static const int maxBucketCount = 1 << 16;
+
+//  distance = min(distance, value); true if value was smaller
+static bool lowerDistance(std::atomic<int>& distance, int value) {
+    int current = distance.load(std::memory_order_relaxed);
+    while(value < current) {
+        if(distance.compare_exchange_weak(current, value, std::memory_order_relaxed)) {
+            return true;
+        }
+    }
+    return false;
+}
 
-        //  Function to get the minimum distance of the vertexes (in distances) that has not been visited yet (indicated by the visited array)
-        for(int k = 0; k < (int)this->vertices.size(); k++) {
-            if(distances[k] < minDist && visited[k] == false) {     //  compare distance[k] with the current minDist
-                minDist = distances[k];                             //  if a new min is found, assign it to minDist
-                u = k;                                              //  the index of the min is assigned to u
+/*  --
+    CSR view of a Graph for performDeltaStepping: the edges of every vertex are split into light ones
+    (weight <= delta) at targets[offsets[v] .. lightEnds[v]) and heavy ones at targets[lightEnds[v] .. offsets[v+1]).
+--  */
+struct DeltaSteppingView {
+    std::vector<int> offsets;
+    std::vector<int> lightEnds;
+    std::vector<int> targets;
+    std::vector<int> weights;
+    std::unique_ptr<std::atomic<int>[]> distances;
+    int threadCount;
+
+    //  relaxes the light or heavy edges of the vertices in frontier; every vertex that got a smaller distance is
+    //  added to improved (possibly more than once)
+    void relax(const std::vector<int>& frontier, bool heavy, std::vector<int>& improved) {
+        if(frontier.empty()) {
+            return;
+        }
+        auto relaxRange = [this, &frontier, heavy](size_t first, size_t last, std::vector<int>& result) {
+            for(size_t f = first; f < last; f++) {
+                int u = frontier[f];
+                int distanceU = this->distances[u].load(std::memory_order_relaxed);
+                int begin = heavy ? this->lightEnds[u] : this->offsets[u];
+                int end = heavy ? this->offsets[u + 1] : this->lightEnds[u];
+                for(int e = begin; e < end; e++) {
+                    long long distance = (long long)distanceU + this->weights[e];
+                    if(distance < INT_MAX && lowerDistance(this->distances[this->targets[e]], (int)distance)) {
+                        result.push_back(this->targets[e]);
+                    }
+                }
             }
+        };
+        int threadCount = this->threadCount;
+        if(threadCount == 1 || (int)frontier.size() < parallelFrontierCutoff) {
+            relaxRange(0, frontier.size(), improved);
+            return;
         }
-        visited[u] = true;      //  state that the vertex at the index of min has been visited by setting it to true
-
-        /*  --  */
-        /*  The following loop is key for the Djikstra algorithm. It every for every loop pass it checks if a node has been visited (first condition),
-            if the minimum distance is INT_MAX ("INFINITY", second condition), if the there is an edge between the two vertices (third condition, as edges
-            are represented trough entries at adjacencyMatrix[u][a]) and if the minimal distance + the edge weight is samller than distance at the current
-            distance (distances[a], fourth condition). Only if a vertex has NOT been visited, the minimal distance is NOT INT_MAX, there IS an edge between
-            the two vertices and the minimal distance + adjacencyMatrix[u][a] IS SMALLER, adjust the distance at position a.
-        /  --  */
-
-        for(int a = 0; a < (int)this->vertices.size(); a++) {
-            if(visited[a] == false && distances[u] != INT_MAX && this->adjacencyMatrix[u][a] != INT_MAX && distances[u] + this->adjacencyMatrix[u][a] < distances[a]) {
-                distances[a] = distances[u] + adjacencyMatrix[u][a];
+        //  the threads take chunks of the frontier from a shared counter and collect their improved vertices apart
+        const size_t chunk = 256;
+        std::atomic<size_t> nextChunk(0);
+        std::vector<std::vector<int>> results(threadCount);
+        auto work = [&frontier, &nextChunk, &relaxRange, chunk](std::vector<int>& result) {
+            for(size_t first = nextChunk.fetch_add(chunk); first < frontier.size(); first = nextChunk.fetch_add(chunk)) {
+                relaxRange(first, std::min(first + chunk, frontier.size()), result);
             }
+        };
+        std::vector<std::future<void>> helpers;
+        for(int t = 1; t < threadCount; t++) {
+            helpers.push_back(std::async(std::launch::async, work, std::ref(results[t])));
+        }
+        work(results[0]);
+        for(auto & helper : helpers) {
+            helper.get();
         }
+        for(auto & result : results) {
+            improved.insert(improved.end(), result.begin(), result.end());
+        }
+    }
+};
 
+void Graph::performDeltaStepping(int src, DijkstraWorkspace& workspace, int delta) const {
+    int vertexCount = (int)this->vertices.size();
+    workspace.prepare(vertexCount);
+    if(!this->validVertex(src)) {
+        std::cerr << "Vertex not found!\n";
+        return;
+    }
+
+    //  delta = mean edge weight: a bucket then spans about one edge, so its vertices form a front that can be
+    //  relaxed together, and few vertices are relaxed again after a light edge lowered their distance
+    DeltaSteppingView view;
+    long long weightSum = 0;
+    int edgeCount = 0;
+    int maxWeight = 0;
+    for(int u = 0; u < vertexCount; u++) {
+        this->forEachEdge(u, [&weightSum, &edgeCount, &maxWeight](int, int weight) {
+            weightSum += weight;
+            edgeCount++;
+            maxWeight = std::max(maxWeight, weight);
+        });
+    }
+    if(delta <= 0) {
+        delta = edgeCount == 0 ? 1 : (int)std::max(1LL, weightSum / edgeCount);
+    }
+    delta = std::max(delta, maxWeight / maxBucketCount);
+    view.offsets.resize(vertexCount + 1);
+    view.lightEnds.resize(vertexCount);
+    view.targets.resize(edgeCount);
+    view.weights.resize(edgeCount);
+    int position = 0;
+    for(int u = 0; u < vertexCount; u++) {
+        view.offsets[u] = position;
+        this->forEachEdge(u, [&view, &position, delta](int v, int weight) {
+            if(weight <= delta) {
+                view.targets[position] = v;
+                view.weights[position] = weight;
+                position++;
+            }
+        });
+        view.lightEnds[u] = position;
+        this->forEachEdge(u, [&view, &position, delta](int v, int weight) {
+            if(weight > delta) {
+                view.targets[position] = v;
+                view.weights[position] = weight;
+                position++;
+            }
+        });
+    }
+    view.offsets[vertexCount] = position;
+    view.threadCount = (int)std::max(1u, std::thread::hardware_concurrency());
+    view.distances.reset(new std::atomic<int>[vertexCount]);
+    for(int v = 0; v < vertexCount; v++) {
+        view.distances[v].store(INT_MAX, std::memory_order_relaxed);
+    }
+
+    /*  --
+        Bucket i holds the vertices with a tentative distance in [i * delta, (i+1) * delta). All tentative distances
+        lie within maxWeight of the current bucket, so maxWeight / delta + 2 buckets are used round robin. Vertices
+        are not removed when their distance drops, a bucket entry is skipped if the vertex belongs to another one.
+        nonEmpty holds the number of every bucket that got vertices, so the loop goes straight to the next one
+        instead of stepping through the empty buckets in between.
+    --  */
+    long long bucketCount = maxWeight / delta + 2;
+    std::vector<std::vector<int>> buckets(bucketCount);
+    std::priority_queue<long long, std::vector<long long>, std::greater<long long>> nonEmpty;
+    std::vector<int> frontierPhase(vertexCount, -1);    //  last phase that took the vertex into the frontier
+    std::vector<long long> settledBucket(vertexCount, -1);
+    std::vector<int> candidates, frontier, settled, improved;
+    long long current = 0;
+    auto enqueue = [&view, &buckets, &nonEmpty, &current, delta, bucketCount](const std::vector<int>& vertices) {
+        for(int v : vertices) {
+            long long index = view.distances[v].load(std::memory_order_relaxed) / delta;
+            std::vector<int>& bucket = buckets[index % bucketCount];
+            //  the current bucket is emptied by the loop below anyway
+            if(bucket.empty() && index != current) {
+                nonEmpty.push(index);
+            }
+            bucket.push_back(v);
+        }
+    };
+    view.distances[src].store(0, std::memory_order_relaxed);
+    buckets[0].push_back(src);
+    nonEmpty.push(0);
+    int phase = 0;
+    while(!nonEmpty.empty()) {
+        current = nonEmpty.top();
+        nonEmpty.pop();
+        std::vector<int>& bucket = buckets[current % bucketCount];
+        settled.clear();
+        //  light edges can put vertices back into the current bucket, so it is emptied until it stays empty
+        while(!bucket.empty()) {
+            candidates.swap(bucket);
+            phase++;
+            frontier.clear();
+            for(int v : candidates) {
+                if(view.distances[v].load(std::memory_order_relaxed) / delta == current && frontierPhase[v] != phase) {
+                    frontierPhase[v] = phase;
+                    frontier.push_back(v);
+                    if(settledBucket[v] != current) {
+                        settledBucket[v] = current;
+                        settled.push_back(v);
+                    }
+                }
+            }
+            candidates.clear();
+            improved.clear();
+            view.relax(frontier, false, improved);
+            enqueue(improved);
+        }
+        //  heavy edges lead past the current bucket and are relaxed once with the final distances of its vertices
+        improved.clear();
+        view.relax(settled, true, improved);
+        enqueue(improved);
+    }
+
+    //  parents: breadth-first from src over the edges that lie on shortest paths, also right with weight 0 edges
+    for(int v = 0; v < vertexCount; v++) {
+        int distance = view.distances[v].load(std::memory_order_relaxed);
+        if(distance != INT_MAX) {
+            workspace.distances[v] = distance;
+            workspace.reach(v);
+        }
+    }
+    std::vector<bool> visited(vertexCount, false);
+    std::vector<int> queue(1, src);
+    visited[src] = true;
+    for(size_t head = 0; head < queue.size(); head++) {
+        int u = queue[head];
+        for(int e = view.offsets[u]; e < view.offsets[u + 1]; e++) {
+            int v = view.targets[e];
+            if(!visited[v] && (long long)workspace.distances[u] + view.weights[e] == workspace.distances[v]) {
+                visited[v] = true;
+                workspace.parents[v] = u;
+                queue.push_back(v);
+            }
+        }
+    }
+    for(int v : queue) {
+        workspace.settle(v);
     }
-    return distances;
 }
 
 
 
 
-void Graph::_letTheSalesmanTravel(const std::string& vertex, std::vector<bool>& visited, const std::string& startingPoint) {
-    std::string nearestNeighbour;
+void Graph::_letTheSalesmanTravel(int vertex, std::vector<bool>& visited, int startingPoint) {
+    int nearestNeighbour;
 
     /*  std::count takes two arguments of type InputIterator, which are returned by both a vector's begin() and end() function and a
         value to compare it to as a third argument. It will then count the occurences of this third argument in a range between the 
@@ -262,19 +734,13 @@ void Graph::_letTheSalesmanTravel(const std::string& vertex, std::vector<bool>&
         round trip
     */
     if(std::count(visited.begin(), visited.end(), false) == 0) {    //  if all vertices have been visited
-        int startIndex = this->resolveVertex(startingPoint);        //  resolve the initial vertex
-        int vertexIndex = this->resolveVertex(vertex);              //  ...and the current vertex
-        if(startIndex == -1 || vertexIndex == -1) {                 //  Error-handling if either initial or current vertex could not be resolved
-            std::cerr << "Vertex not found!\n";
-            exit(1);
-        }
         //std::cout << " -(";
-        if(this->adjacencyMatrix[startIndex][vertexIndex] == INT_MAX) {
+        if(this->edgeWeight(startingPoint, vertex) == INT_MAX) {
             performPrimeMST(vertex, startingPoint);
         } else {
             std::cout << " -(";
-            std::cout << this->adjacencyMatrix[startIndex][vertexIndex];
-            std::cout << ")-> " << startingPoint << "\n";
+            std::cout << this->edgeWeight(startingPoint, vertex);
+            std::cout << ")-> " << this->vertices[startingPoint] << "\n";
         }
         //std::cout << ")-> " << startingPoint << "\n";    // output that connects the current vertex and the starting point again
         for(int i = 0; i < (int)this->vertices.size(); i++) {    //  setting every entry of "visited" to false
@@ -292,58 +758,48 @@ void Graph::_letTheSalesmanTravel(const std::string& vertex, std::vector<bool>&
     -   The function will terminate the whole program if the vertex (from the param) cannot be resolved!
 */
 std::string Graph::getNearestNeighbour(const std::string& vertex, std::vector<bool>& visited) {
+    return this->vertices[this->getNearestNeighbour(this->resolveVertex(vertex), visited)];
+}
+
+int Graph::getNearestNeighbour(int vertexPos, std::vector<bool>& visited) {
     int nearestNeighbour = INT_MAX; //  initialization of the nearestNeighbour as the index in this->vertices
     int distNearest = INT_MAX;      //  initialization of the nearest distance; not completely necessary, it just improves the readability of the code
 
-    int vertexPos = this->resolveVertex(vertex);    //  Error handling in case the vertex could not be found in this->vertices
-    if(vertexPos == -1) {
+    if(!this->validVertex(vertexPos)) {     //  Error handling in case the vertex could not be found in this->vertices
         std::cerr << "Vertex not found!\n";
         exit(1);
     }
 
-    /*  looping through all vertices to find which of these is nearest  */
-    for(int i = 0; i < (int)this->vertices.size(); i++) {
+    /*  looping through the edges of the vertex to find which of the unvisited targets is nearest  */
+    this->forEachEdge(vertexPos, [&](int i, int weight) {
         /*  This if condition checks whether the distance between the vertex from the first input param and this->vertices[i]
             fulfills the condition of <= distNearest. If so, it will assign the corresponding values to nearestNeighbour and distNearest.
-            It should be noted that it is crucial to compare with "<=" rather than just "<", because only this way it can be ensured that 
-            there will ALWAYS be a result, as long as at least one vertex has not been visited. Let's say, we landed at a vertex that is not
-            connected to any city that has not yet been visited. If we used "<", the result for nearestNeighbour would be INT_MAX, as it has
-            been used to initialize the variable nearestNeighbour, as no city would be closer than INT-MAX (this is because the adjacency matrix
-            has been altered to previous versions). By utilizing "<=", it now chooses a city within the bounds of this->vertices, even though the distance
-            will be INT_MAX
+            With "<=" the last of several equally near vertices is taken.
         */
-        if(this->adjacencyMatrix[vertexPos][i] <= distNearest && !visited[i]) {
+        if(weight <= distNearest && !visited[i]) {
+            nearestNeighbour = i;
+            distNearest = weight;
+        }
+    });
+    /*  Let's say, we landed at a vertex that is not connected to any city that has not yet been visited. Then there has to be a result anyway,
+        as long as at least one vertex has not been visited: the last unvisited city is chosen, even though the distance will be INT_MAX
+    */
+    for(int i = (int)this->vertices.size() - 1; nearestNeighbour == INT_MAX && i >= 0; i--) {
+        if(!visited[i]) {
             nearestNeighbour = i;
-            distNearest = this->adjacencyMatrix[vertexPos][i];
         }
     }
 
     visited[nearestNeighbour] = true; //    mark the nearestVertex as visited
 
-    std::stringstream s;
         if(distNearest == INT_MAX) {
-            performPrimeMST(vertex, this->vertices[nearestNeighbour]);
+            performPrimeMST(vertexPos, nearestNeighbour);
         } else {
             std::cout << " -(";
             std::cout << distNearest;
             std::cout << ")-> " << this->vertices[nearestNeighbour];
         }
-    s << this->vertices[nearestNeighbour];
-    return s.str();
-}
-
-int Graph::miniDist(const int dist[], const bool sptSet[]){
-    int min = INT_MAX;
-    int min_index;
-
-    for (int i = 0; i < this->vertices.size(); i++){
-        if (!sptSet[i] && dist[i] <= min){
-            min = dist[i];
-            min_index = i;
-        }
-    }
-
-    return min_index;
+    return nearestNeighbour;
 }
 
 void Graph::printPath(int parent[], int j, int dist[]){
@@ -357,47 +813,15 @@ void Graph::printPath(int parent[], int j, int dist[]){
 }
 
 void Graph::performPrimeMST(const std::string& sourceVertex, const std::string& targetVertex){
+    this->performPrimeMST(this->resolveVertex(sourceVertex), this->resolveVertex(targetVertex));
+}
 
-    auto src = this->resolveVertex(sourceVertex);
-    auto dest = this->resolveVertex(targetVertex);
-    auto max_size = vertices.size();
-
-    int dist[max_size];
-    bool sptSet[max_size];
-    int parent[max_size];
-
-    for(int i = 0; i < max_size; i++){
-        parent[i] = -1;
-        sptSet[i] = false;
-    }
-
-    for (int i = 0; i < max_size; i++){
-        dist[i] = INT_MAX;
-    }
-
-    dist[src] = 0;
-
-    for (int count = 0; count < max_size-1; count++) {
-        int u = miniDist(dist, sptSet);
-        sptSet[u] = true;
-
-        for (int v = 0; v < max_size; v++){
-
-            int temp;
-
-            //Only needed because original Code was implemented for unconnected edges = 0 and not INT_MAX
-            if(adjacencyMatrix[u][v] == INT_MAX){
-                temp = 0;
-            }else{
-                temp = adjacencyMatrix[u][v];
-            }
-
-            if ((!sptSet[v] && temp && dist[u] + temp < dist[v]) ){
-                parent[v] = u;
-                dist[v] = dist[u] + temp;
-            }
-        }
+void Graph::performPrimeMST(int src, int dest){
+    if(!this->validVertex(src) || !this->validVertex(dest)) {
+        std::cerr << "Vertex not found!\n";
+        return;
     }
+    this->performDijkstra(src, this->workspace, DijkstraHeap::Radix, dest);   //  stops as soon as dest is reached
 
-    printPath(parent, dest, dist);
+    printPath(this->workspace.parents.data(), dest, this->workspace.distances.data());
 }
\ No newline at end of file
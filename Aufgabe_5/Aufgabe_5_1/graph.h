@@ -7,8 +7,11 @@
 #include <sstream>  /*  type stringstream to easily concat a result string  */
 #include <limits.h> /*  INT_MAX */
 #include <algorithm>
+#include <unordered_map> /*  name -> index lookup in resolveVertex  */
 
 #include "edge.h"
+#include "dijkstra.h"
+#include "floydWarshall.h"
 
 
 #define V 10
@@ -19,23 +22,76 @@ void vectorToString(std::vector<std::string> vector);
 
 /*  --  Class Graph --  */
 class Graph {
+    public:
+        /*  --
+            Matrix: the VxV adjacencyMatrix, INT_MAX stands for "no edge".
+            CSR (compressed sparse row): the edges of vertex u are targets[offsets[u] .. offsets[u+1]), their weights
+            sit at the same positions in weights, sorted by target. O(V+E) memory and neighbours are read one after
+            the other; adjacencyMatrix stays empty. Inserting or deleting single edges or vertices costs O(V+E), so
+            large graphs should be passed to the constructor as a whole.
+            Edges are undirected in both storages, every edge is kept once per direction.
+        --  */
+        enum class Storage { Matrix, CSR };
+
     private:
         std::vector<std::string> vertices;                  //  vector connecting vertices with indicies; needed for name resolution
-        void _letTheSalesmanTravel(const std::string& vertex, std::vector<bool>& visited, const std::string& startingPoint);
+        std::unordered_map<std::string, int> vertexIds;     //  name -> index in vertices, so resolveVertex does not compare every name
+
+        void rebuildVertexIds();                            //  after vertices changed as a whole or indices moved
+        bool validVertex(int vertex) const;                 //  0 <= vertex < number of vertices
+        void _letTheSalesmanTravel(int vertex, std::vector<bool>& visited, int startingPoint);
+
+        Storage storage = Storage::Matrix;
+        std::vector<int> offsets;                           //  CSR: V+1 entries
+        std::vector<int> targets;                           //  CSR: 2E entries
+        std::vector<int> weights;                           //  CSR: 2E entries
+
+        void buildCSR(const std::vector<Edge>& edges);
+        int findEdge(int source, int target) const;         //  CSR: position of the edge in targets, -1 if there is none
+        int edgeWeight(int source, int target) const;       //  INT_MAX if there is no edge, for both storages
+        void setEdge(int source, int target, int weight);   //  one direction, for both storages; INT_MAX removes the edge
+
+        DijkstraWorkspace workspace;                        //  reused by performDijkstra(int) and performPrimeMST
+
+        template<typename Heap>
+        void runDijkstra(int source, int target, DijkstraWorkspace& workspace, Heap& heap) const;
     public:
 
 
 
         Graph();                                            //  default constructor
-        Graph(const std::vector<std::string>& vertices, const std::vector<Edge>& edges);  //  param. constructor
-        std::vector<std::vector<int>> adjacencyMatrix;      //  vector of vectors containing integers (the adjacency matrix)
+        Graph(const std::vector<std::string>& vertices, const std::vector<Edge>& edges, Storage storage = Storage::Matrix);  //  param. constructor
+        std::vector<std::vector<int>> adjacencyMatrix;      //  vector of vectors containing integers (the adjacency matrix); empty with Storage::CSR
+
+        Storage getStorage() const;
+
+        //  calls visit(target, weight) for every edge of vertex, ordered by target
+        template<typename Visit>
+        void forEachEdge(int vertex, Visit visit) const {
+            if(this->storage == Storage::CSR) {
+                for(int e = this->offsets[vertex]; e < this->offsets[vertex + 1]; e++) {
+                    visit(this->targets[e], this->weights[e]);
+                }
+                return;
+            }
+            const std::vector<int>& row = this->adjacencyMatrix[vertex];
+            for(int i = 0; i < (int)row.size(); i++) {
+                if(row[i] != INT_MAX) {
+                    visit(i, row[i]);
+                }
+            }
+        }
         
         /*  --
             Resolves a given string of a vertex and returns its position in the
             adjacencyMatrix (as integer). Returns -1 if name could not be resolved,
             which indicates the the name was not found. 
+            The names are kept in a hash map, so this is O(1) on average; resolve a name once and use the
+            overloads taking the index (id) below when calling several operations for the same vertex.
         --  */
         int resolveVertex(const std::string& name);
+        const std::string& getVertexName(int vertex) const;
+        int getVertexCount() const;
         void printGraph();    //  prints out the graph with vertices and the adjacencyMatrix
 
         /*  --
@@ -43,22 +99,54 @@ class Graph {
         --  */
         void insertVertex(const std::string& vertex);                           //  inserts a new vertex; throws error, if vertex already exists in Graph
         void deleteVertex(const std::string& vertex);                           //  deletes a vertex from the Graph; throws an error, if vertex does not exist
+        void deleteVertex(int vertex);                                          //  ...the indices of all following vertices move down by one
         void insertEdge(const Edge& edge);                                      //  inserts a new edge; parameter can be {std::string, std::string} due to implicit cast...
                                                                                 //  ...does not check if the edge already exists, nor notifies user/programmer
+        void insertEdge(int source, int destination, int weight);
         void deleteEdge(const Edge& edge);                                      //  deletes an edge; parameter can be {std::string, std::string} due to implicit cast...
                                                                                 //  ...does not check if edge exists
+        void deleteEdge(int source, int destination);
         bool adjacent(const std::string& vertex1, const std::string& vertex2);  //  checks if vertex1 and vertex2 are adjacent; returns boolean; adjacency indicates that...
                                                                                 //  ...a direct connection between a <--> b (direction NOT important) exists
+        bool adjacent(int vertex1, int vertex2);
         std::vector<std::string> neighbours(const std::string& vertex);         //  returns a vector of strings, containing all neighbouring vertices of the parameter vertex...
                                                                                 //  ...Neighbours are all vertices that a given vertex is connected to through OUTGOING edges
+        std::vector<int> neighbours(int vertex);                                //  ...or their indices
+                                                                                //  ...an edge is every entry != INT_MAX
         
-        int* performDijkstra(const std::string& sourceVertex);           //  Dijkstra algorithm implementation
+        int* performDijkstra(const std::string& sourceVertex);           //  Dijkstra algorithm implementation; the caller has to free() the distances
+        int* performDijkstra(int sourceVertex);
+
+        /*  --
+            Dijkstra from sourceVertex with the chosen priority queue, O((V+E) log V) (Radix: O(E + V log C) for
+            the largest distance C). The results are left in workspace, see DijkstraWorkspace; with a targetVertex
+            the search ends once its distance is final. The weights must not be negative.
+        --  */
+        void performDijkstra(int sourceVertex, DijkstraWorkspace& workspace, DijkstraHeap heap = DijkstraHeap::Radix, int targetVertex = -1) const;
+
+        /*  --
+            Shortest paths between all pairs of vertices with blocked Floyd-Warshall, O(V^3) but with sequential
+            memory access and the blocks of each phase on all cores; for dense graphs this beats V runs of
+            performDijkstra. Distances and next hops for the paths are left in paths, see AllPairsPaths.
+        --  */
+        void performFloydWarshall(AllPairsPaths& paths) const;
+
+        /*  --
+            Delta-stepping from sourceVertex: the vertices are kept in buckets of width delta by tentative distance,
+            and all vertices of the lowest bucket relax their edges at the same time, spread over the cores with
+            atomic minimum updates. Edges up to delta are relaxed until the bucket stays empty, heavier ones once
+            afterwards. delta <= 0 takes the mean edge weight. Gives the same distances as performDijkstra, the
+            results are left in workspace; the weights must not be negative.
+        --  */
+        void performDeltaStepping(int sourceVertex, DijkstraWorkspace& workspace, int delta = 0) const;
         void letTheSalesmanTravel(const std::string& vertex);
+        void letTheSalesmanTravel(int vertex);
         std::string getNearestNeighbour(const std::string& vertex, std::vector<bool>& visited);
+        int getNearestNeighbour(int vertex, std::vector<bool>& visited);
 
         void printPath(int parent[], int j, int dist[]);
         void performPrimeMST(const std::string& sourceVertex, const std::string& targetVertex);
-        int  miniDist(const int dist[], const bool sptSet[]);
+        void performPrimeMST(int sourceVertex, int targetVertex);
 
     };
 
@@ -5,6 +5,37 @@
 #include <string>   /*  type string  */
 #include <iostream> /*  cout, cerr  */
 #include <sstream>  /*  type stringstream to easily concat a result string  */
+#include <random>   /*  random graphs of TEST_3 and TEST_4  */
+#include <chrono>   /*  run times  */
+#include <climits>  /*  INT_MAX */
+
+/*  --
+    Random graph in CSR storage with vertexCount vertices named "0", "1", ... and edgesPerVertex edges from every
+    vertex to random other ones, weights 1..maxWeight (Graph stores every edge in both directions). weights gets the
+    weight of every edge u -> v at u * vertexCount + v, INT_MAX where there is none.
+--  */
+static Graph randomGraph(int vertexCount, int edgesPerVertex, int maxWeight, std::vector<int>& weights) {
+    std::vector<std::string> names;
+    for(int vertex = 0; vertex < vertexCount; vertex++) {
+        names.push_back(std::to_string(vertex));
+    }
+    std::mt19937 generator(20220604);
+    weights.assign((size_t)vertexCount * vertexCount, INT_MAX);
+    std::vector<Edge> edges;
+    for(int u = 0; u < vertexCount; u++) {
+        for(int i = 0; i < edgesPerVertex; i++) {
+            int v = (int)(generator() % vertexCount);
+            if(v == u || weights[(size_t)u * vertexCount + v] != INT_MAX) {
+                continue;
+            }
+            int weight = 1 + (int)(generator() % maxWeight);
+            weights[(size_t)u * vertexCount + v] = weight;
+            weights[(size_t)v * vertexCount + u] = weight;
+            edges.emplace_back(names[u], names[v], weight);
+        }
+    }
+    return Graph(names, edges, Graph::Storage::CSR);
+}
 
 
 int main() {
@@ -68,4 +99,86 @@ int main() {
         g.letTheSalesmanTravel("Innsbruck");
     }
 
+    std::cout <<  std::endl << "**************************************************************************" << std::endl;
+
+    std::cout << "TEST_3: Shortest paths between all pairs, checked against Dijkstra from every vertex." << std::endl << std::endl;{
+
+        std::vector<int> weights;
+        Graph g = randomGraph(500, 4, 100, weights);
+        int vertexCount = g.getVertexCount();
+
+        AllPairsPaths paths;
+        auto start = std::chrono::steady_clock::now();
+        g.performFloydWarshall(paths);
+        auto end = std::chrono::steady_clock::now();
+        std::cout << "Floyd-Warshall for " << vertexCount << " vertices: "
+                  << std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count() << " ms" << std::endl;
+
+        DijkstraWorkspace workspace;
+        int wrongDistances = 0;
+        int wrongPaths = 0;
+        start = std::chrono::steady_clock::now();
+        for(int source = 0; source < vertexCount; source++) {
+            g.performDijkstra(source, workspace);
+            for(int target = 0; target < vertexCount; target++) {
+                wrongDistances += paths.distance(source, target) != workspace.distances[target] ? 1 : 0;
+            }
+        }
+        end = std::chrono::steady_clock::now();
+        //  every path has to lead over edges of the graph and be as long as the distance
+        for(int source = 0; source < vertexCount; source++) {
+            for(int target = 0; target < vertexCount; target++) {
+                std::vector<int> path = paths.path(source, target);
+                long long length = path.empty() ? INT_MAX : 0;
+                for(size_t i = 1; i < path.size() && length != INT_MAX; i++) {
+                    int weight = weights[(size_t)path[i - 1] * vertexCount + path[i]];
+                    length = weight == INT_MAX ? INT_MAX : length + weight;
+                }
+                wrongPaths += length != paths.distance(source, target) ? 1 : 0;
+            }
+        }
+        std::cout << vertexCount << " times Dijkstra: "
+                  << std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count() << " ms" << std::endl;
+        std::cout << "Distances different from Dijkstra: " << wrongDistances << ", paths not matching their distance: "
+                  << wrongPaths << std::endl;
+    }
+
+    std::cout <<  std::endl << "**************************************************************************" << std::endl;
+
+    std::cout << "TEST_4: Delta-stepping from 20 sources, checked against Dijkstra." << std::endl << std::endl;{
+
+        //  delta 0 takes the mean edge weight; delta 1 with weights up to 100000 leaves most buckets empty
+        struct Case { int maxWeight; int delta; };
+        for(Case c : {Case{100, 0}, Case{100, 1}, Case{100000, 1}}) {
+            std::vector<int> weights;
+            Graph g = randomGraph(2000, 4, c.maxWeight, weights);
+            int vertexCount = g.getVertexCount();
+            DijkstraWorkspace reference;
+            DijkstraWorkspace workspace;
+            int wrongDistances = 0;
+            int wrongParents = 0;
+            long long microseconds = 0;
+            for(int source = 0; source < vertexCount; source += vertexCount / 20) {
+                g.performDijkstra(source, reference);
+                auto start = std::chrono::steady_clock::now();
+                g.performDeltaStepping(source, workspace, c.delta);
+                auto end = std::chrono::steady_clock::now();
+                microseconds += std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
+                for(int v = 0; v < vertexCount; v++) {
+                    wrongDistances += workspace.distances[v] != reference.distances[v] ? 1 : 0;
+                    //  the parent has to be reached over an edge that lies on a shortest path
+                    int parent = workspace.parents[v];
+                    if(parent != -1) {
+                        int weight = weights[(size_t)parent * vertexCount + v];
+                        wrongParents += weight == INT_MAX || (long long)workspace.distances[parent] + weight != workspace.distances[v] ? 1 : 0;
+                    } else {
+                        wrongParents += v != source && workspace.distances[v] != INT_MAX ? 1 : 0;
+                    }
+                }
+            }
+            std::cout << "Weights 1.." << c.maxWeight << ", delta " << c.delta << ": " << microseconds << " us, "
+                      << "distances different from Dijkstra: " << wrongDistances << ", wrong parents: " << wrongParents << std::endl;
+        }
+    }
+
 }
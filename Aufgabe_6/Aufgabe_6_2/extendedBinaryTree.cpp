@@ -1,43 +1,205 @@
 #include "extendedBinaryTree.h"
 #include <iostream>
 #include <iomanip>
+#include <random>
+#include <queue>
+#include <functional>
+#include <algorithm>
+
+//  strict total order of the tree: Verkaufspreis first, equal prices are separated by Seriennummer and address
+bool BinaryTree::isLess(const Ware* a, const Ware* b) {
+    if(a->getVerkaufspreis() != b->getVerkaufspreis()) {
+        return a->getVerkaufspreis() < b->getVerkaufspreis();
+    }
+    if(a->getSeriennummer() != b->getSeriennummer()) {
+        return a->getSeriennummer() < b->getSeriennummer();
+    }
+    return std::less<const Ware*>()(a, b);
+}
+
+// perform a left rotation, the right child becomes the root of the subtree
+Ware* BinaryTree::rotateLeft(Ware* node) {
+    Ware* rightNode = node->right;
+    node->right = rightNode->left;
+    rightNode->left = node;
+    return rightNode;
+}
+
+// perform a right rotation, the left child becomes the root of the subtree
+Ware* BinaryTree::rotateRight(Ware* node) {
+    Ware* leftNode = node->left;
+    node->left = leftNode->right;
+    leftNode->right = node;
+    return leftNode;
+}
 
 void BinaryTree::insert(Ware * key, int priority) {
-    this->temp[priority-1] = key;
-    int counter = 9;
+    key->priority = priority;
+    key->left = nullptr;
+    key->right = nullptr;
+    this->rootNode = insertNode(this->rootNode, key);
+}
 
-    for(auto & i : this->temp){
-        if(i != nullptr){
-            counter--;
-        }
-    }
+void BinaryTree::insert(Ware * key) {
+    static std::mt19937 generator(std::random_device{}());
+    this->insert(key, (int)(generator() >> 1));
+}
 
-    if(counter == 0){
-        for(auto & i : this->temp){
-            this->rootNode->insert(i);
+//  BST insert at a leaf, then rotate the new node up as long as it has a smaller priority than its parent
+Ware* BinaryTree::insertNode(Ware* node, Ware* value) {
+    if(node == nullptr) {
+        return value;
+    }
+    if(isLess(value, node)) {
+        node->left = insertNode(node->left, value);
+        if(node->left->priority < node->priority) {
+            node = rotateRight(node);
+        }
+    } else {
+        node->right = insertNode(node->right, value);
+        if(node->right->priority < node->priority) {
+            node = rotateLeft(node);
         }
     }
-
+    return node;
 }
 
-//Not in use and not tested
 Ware* BinaryTree::search(Ware * key) {
     Ware* node = this->rootNode;
-    while(key != node->key) {
-        if(key > node->key) {
-            node = node->right;
+    while(node != nullptr && node != key) {
+        if(isLess(key, node)) {
+            node = node->left;
         } else {
+            node = node->right;
+        }
+    }
+    return node;
+}
+
+//  returns the first Ware found with exactly this Verkaufspreis, nullptr if there is none
+Ware* BinaryTree::search(double verkaufspreis) {
+    Ware* node = this->rootNode;
+    while(node != nullptr && node->getVerkaufspreis() != verkaufspreis) {
+        if(verkaufspreis < node->getVerkaufspreis()) {
             node = node->left;
+        } else {
+            node = node->right;
         }
     }
     return node;
 }
 
 Ware* BinaryTree::deleteItem(Ware* key) {
-    return this->rootNode->deleteItem(key);
+    Ware* removed = nullptr;
+    this->rootNode = deleteNode(this->rootNode, key, removed);
+    return removed;
+}
+
+//  rotate the node down (always towards the child with the smaller priority) until it is a leaf, then cut it off
+Ware* BinaryTree::deleteNode(Ware* node, Ware* value, Ware*& removed) {
+    if(node == nullptr) {
+        return nullptr;
+    }
+    if(node != value) {
+        if(isLess(value, node)) {
+            node->left = deleteNode(node->left, value, removed);
+        } else {
+            node->right = deleteNode(node->right, value, removed);
+        }
+        return node;
+    }
+
+    if(node->left == nullptr || node->right == nullptr) {
+        removed = node;
+        Ware* child = node->left ? node->left : node->right;
+        node->left = nullptr;
+        node->right = nullptr;
+        return child;
+    }
+    if(node->left->priority < node->right->priority) {
+        node = rotateRight(node);
+        node->right = deleteNode(node->right, value, removed);
+    } else {
+        node = rotateLeft(node);
+        node->left = deleteNode(node->left, value, removed);
+    }
+    return node;
+}
+
+//  first: all prices < verkaufspreis, second: all prices >= verkaufspreis
+std::pair<Ware*, Ware*> BinaryTree::splitNode(Ware* node, double verkaufspreis) {
+    if(node == nullptr) {
+        return {nullptr, nullptr};
+    }
+    if(node->getVerkaufspreis() < verkaufspreis) {
+        auto parts = splitNode(node->right, verkaufspreis);
+        node->right = parts.first;
+        return {node, parts.second};
+    }
+    auto parts = splitNode(node->left, verkaufspreis);
+    node->left = parts.second;
+    return {parts.first, node};
+}
+
+//  every key in left is smaller than every key in right, the root with the smaller priority stays on top
+Ware* BinaryTree::mergeNodes(Ware* left, Ware* right) {
+    if(left == nullptr) {
+        return right;
+    }
+    if(right == nullptr) {
+        return left;
+    }
+    if(left->priority <= right->priority) {
+        left->right = mergeNodes(left->right, right);
+        return left;
+    }
+    right->left = mergeNodes(left, right->left);
+    return right;
+}
+
+BinaryTree BinaryTree::split(double verkaufspreis) {
+    auto parts = splitNode(this->rootNode, verkaufspreis);
+    this->rootNode = parts.first;
+    BinaryTree upper;
+    upper.rootNode = parts.second;
+    return upper;
+}
+
+void BinaryTree::merge(BinaryTree& other) {
+    this->rootNode = mergeNodes(this->rootNode, other.rootNode);
+    other.rootNode = nullptr;
+}
+
+/*  Cartesian tree construction in O(n):
+    the stack holds the right spine of the tree built so far. Every new (largest) Ware pops all spine nodes with a
+    larger priority, takes the last popped one as its left subtree and is appended at the end of the spine.
+    Every Ware is pushed and popped at most once.
+ */
+BinaryTree BinaryTree::buildFromSorted(const std::vector<Ware*>& waren) {
+    std::vector<Ware*> spine;
+    spine.reserve(64);
+
+    for(Ware* ware : waren) {
+        ware->left = nullptr;
+        ware->right = nullptr;
+
+        Ware* lastPopped = nullptr;
+        while(!spine.empty() && spine.back()->priority > ware->priority) {
+            lastPopped = spine.back();
+            spine.pop_back();
+        }
+        ware->left = lastPopped;
+        if(!spine.empty()) {
+            spine.back()->right = ware;
+        }
+        spine.push_back(ware);
+    }
+
+    BinaryTree tree;
+    tree.rootNode = spine.empty() ? nullptr : spine.front();
+    return tree;
 }
 
-//Not in use and not tested
 Ware* BinaryTree::findMin(Ware* node) {
     while(node->left != nullptr) {
         node = node->left;
@@ -45,7 +207,6 @@ Ware* BinaryTree::findMin(Ware* node) {
     return node;
 }
 
-//Not in use and not tested
 Ware* BinaryTree::findMax(Ware* node) {
     while(node->right != nullptr) {
         node = node->right;
@@ -53,6 +214,17 @@ Ware* BinaryTree::findMax(Ware* node) {
     return node;
 }
 
+int BinaryTree::getHeight(Ware* node) {
+    if(node == nullptr) {
+        return 0;
+    }
+    return 1 + std::max(getHeight(node->left), getHeight(node->right));
+}
+
+int BinaryTree::getHeight() {
+    return getHeight(this->rootNode);
+}
+
 /*Pre-order, NLR
     Visit the current node (in the figure: position red).
     Recursively traverse the current node's left subtree.
@@ -76,6 +248,9 @@ std::string BinaryTree::printPreorder(Ware* node) {
 }
 
 std::string BinaryTree::printPreorder() {
+    if(this->rootNode == nullptr) {
+        return "";
+    }
     return this->printPreorder(this->rootNode);
 }
 
@@ -104,6 +279,9 @@ std::string BinaryTree::printPostorder(Ware *node) {
 }
 
 std::string BinaryTree::printPostorder() {
+    if(this->rootNode == nullptr) {
+        return "";
+    }
     return this->printPostorder(this->rootNode);
 }
 
@@ -133,52 +311,41 @@ std::string BinaryTree::printInorder(Ware *node) {
 }
 
 std::string BinaryTree::printInorder() {
+    if(this->rootNode == nullptr) {
+        return "";
+    }
     return this->printInorder(this->rootNode);
 }
 
-int counter = 1;
-
+/*
+Priority order
+    The treap is a min-heap on the priority, so the root has the smallest priority and every node is smaller than
+    its children. Keeping the not yet printed children in a priority queue prints the nodes in ascending priority.
+ */
 std::string BinaryTree::printPriority(Ware* node){
     std::stringstream output;
+    auto greaterPriority = [](const Ware* a, const Ware* b) { return a->priority > b->priority; };
+    std::priority_queue<Ware*, std::vector<Ware*>, decltype(greaterPriority)> frontier(greaterPriority);
 
-    output << node->getVerkaufspreis() << std::endl;
-
-    if(node->right != nullptr && ((node->priority + 1) == node->right->priority)){
-        counter ++;
-        output << this->printPriority(node->right);
-    }
-
-    if(node->left != nullptr && ((node->priority + 1) == node->left->priority)){
-        counter ++;
-        output << this->printPriority(node->left);
+    if(node != nullptr) {
+        frontier.push(node);
     }
-
-    if(this->rootNode->right != nullptr && (this->rootNode->priority + counter == this->rootNode->right->priority)){
-        counter++;
-        output << this->printPriority(this->rootNode->right);
-    }
-
-    if(this->rootNode->left != nullptr && (this->rootNode->priority + counter == this->rootNode->left->priority)){
-        counter++;
-        output << this->printPriority(this->rootNode->left);
+    while(!frontier.empty()) {
+        Ware* current = frontier.top();
+        frontier.pop();
+        output << std::left << std::setfill(' ') << std::setw(9) << current->getVerkaufspreis()
+        << " Prio: " << current->priority << std::endl;
+
+        if(current->left != nullptr) {
+            frontier.push(current->left);
+        }
+        if(current->right != nullptr) {
+            frontier.push(current->right);
+        }
     }
-
     return output.str();
 }
 
 std::string BinaryTree::printPriority() {
-
-    //Fake Ausgabe welche aus dem temp arry ausliesst
-    std::cout << "Fake ausgabe: " << std::endl;
-    std::cout << std::left << std::setfill(' ') << std::setw(9) << this->rootNode->getVerkaufspreis()
-    << " Prio: " << this->rootNode->priority << std::endl;
-    for(auto & i : temp){
-        std::cout << std::left << std::setfill(' ') << std::setw(9) << i->getVerkaufspreis() << " Prio: "
-        << i->priority << std::endl;
-    }
-
-    //Die Rekursion laeft nicht sauber bis zum Ende durch
-    std::cout << std::endl << "Richtige Ausgabe die aber nicht durchlaeuft: " << std::endl;
-
     return this->printPriority(this->rootNode);
 }
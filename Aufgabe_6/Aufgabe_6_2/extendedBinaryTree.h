@@ -1,25 +1,50 @@
+#ifndef AUFGABE_6_2_EXTENDEDBINARYTREE_H
+#define AUFGABE_6_2_EXTENDEDBINARYTREE_H
+
 #include "extendedBinaryTreeNode.h"
 #include <string>
 #include <sstream>
+#include <utility>
+#include <vector>
 
+/*  --
+    Treap (tree + heap) of Ware:
+        - in-order the nodes are sorted by Verkaufspreis (ties broken by Seriennummer and address),
+        - on every root-to-leaf path the priority never decreases (min-heap, priority 0 is the root).
+    With random priorities the shape equals a randomly built BST, so every operation is expected O(log n)
+    regardless of the insertion order.
+--  */
 class BinaryTree {
     public:
     Ware* rootNode;
 
-    Ware* temp[9] ={nullptr,nullptr,nullptr,nullptr,nullptr,nullptr,nullptr,nullptr,nullptr};
-
-
+        BinaryTree() {
+            this->rootNode = nullptr;
+        };
 
         BinaryTree(Ware * test) {
-            Ware* root = test;
-            this->rootNode = root;
+            this->rootNode = nullptr;
+            this->insert(test, test->priority);
         };
 
         Ware* search(Ware * key);
-        void insert(Ware* key, int priority);
-        Ware* deleteItem(Ware* key);
+        Ware* search(double verkaufspreis);
+        void insert(Ware* key, int priority);   //  inserts with the given priority
+        void insert(Ware* key);                 //  inserts with a random priority
+        Ware* deleteItem(Ware* key);            //  unlinks key from the tree and returns it (nullptr if not found), the caller owns it
         Ware* findMin(Ware* node);
         Ware* findMax(Ware* node);
+        int getHeight();
+
+        /*  --
+            split: moves every Ware with Verkaufspreis >= verkaufspreis into the returned tree, O(log n)
+            merge: appends other to this tree; every price in other has to be >= every price in this tree, O(log n)
+        --  */
+        BinaryTree split(double verkaufspreis);
+        void merge(BinaryTree& other);
+
+        //  O(n) Cartesian tree build; waren has to be sorted by Verkaufspreis, the priority of every Ware is kept
+        static BinaryTree buildFromSorted(const std::vector<Ware*>& waren);
 
         //Further information's: https://en.wikipedia.org/wiki/Tree_traversal#In-order_(LNR)
         std::string printPreorder(Ware* node);
@@ -30,4 +55,16 @@ class BinaryTree {
         std::string printInorder();
         std::string printPriority(Ware* node);
         std::string printPriority();
+
+    private:
+        static bool isLess(const Ware* a, const Ware* b);
+        static Ware* rotateLeft(Ware* node);
+        static Ware* rotateRight(Ware* node);
+        static Ware* insertNode(Ware* node, Ware* value);
+        static Ware* deleteNode(Ware* node, Ware* value, Ware*& removed);
+        static std::pair<Ware*, Ware*> splitNode(Ware* node, double verkaufspreis);
+        static Ware* mergeNodes(Ware* left, Ware* right);
+        static int getHeight(Ware* node);
 };
+
+#endif //AUFGABE_6_2_EXTENDEDBINARYTREE_H
@@ -98,58 +98,3 @@ void Ware::setVerkaufspreis(double verkaufspreis) {
         std::cout << std::endl << "*** ErrorWare: " << e.what() << " *** " << std::endl << std::endl;
     }
 }
-
-//Insert according three rules
-Ware* Ware::insert(Ware * value) {
-    if(value->getVerkaufspreis() > this->getVerkaufspreis()) {
-        //std::cout << "***********" << this->getVerkaufspreis() << std::endl;
-        if(this->right == nullptr) {
-            Ware* temp = value;
-            this->right = temp;
-            return this->right;
-        }
-        this->right->insert(value);
-    } else {
-        if(this->left == nullptr) {
-            Ware* temp = value;
-            this->left = temp;
-            return this->left;
-        }
-        this->left->insert(value);
-    }
-    return this;
-}
-
-//Deleting and rearranging three
-Ware* Ware::deleteItem(Ware * value) {
-    Ware* node = this;
-
-    if(node == nullptr) {
-        return this;
-    } else if(value->getVerkaufspreis() < node->getVerkaufspreis()) {
-        node->left = node->left->deleteItem(value);
-    } else if(value->getVerkaufspreis() > node->getVerkaufspreis()) {
-        node->right = node->right->deleteItem(value);
-    } else {
-        if(node->left == nullptr && node->right == nullptr) {
-            delete node;
-            node = nullptr;
-        } else if(node->left == nullptr) { // only children in right subtree
-            Ware* temp = node;
-            node = node->right;
-            delete temp;
-        } else if(this->right == nullptr) { // only children in left subtree
-            Ware* temp = node;
-            node = node->left;
-            delete temp;
-        } else { // we have to keep the BST structure, here, we look for the minimum in the right subtree (see lecture)
-            Ware* temp = node->right;
-            while(temp->left != nullptr) {
-                temp = temp->left;
-            }
-            node->key = temp->key;
-            node->right = node->right->deleteItem(temp);
-        }
-    }
-    return node;
-}
\ No newline at end of file
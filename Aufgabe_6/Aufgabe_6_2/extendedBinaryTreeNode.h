@@ -8,6 +8,7 @@
 #include <string>
 #include <iostream>
 #include <map>
+#include <utility>
 #include <vector>
 #include "binders.h"
 
@@ -15,8 +16,8 @@
 class Ware {
 
 private:
-    //Name pool for random creation of products
-    std::string name_array[10] = {"Schwert", "Trank", "Kraeuter", "Pilz", "Stein", "Fisch",
+    //Name pool for random creation of products; static, so millions of Ware do not carry ten strings each
+    static inline const std::string name_array[10] = {"Schwert", "Trank", "Kraeuter", "Pilz", "Stein", "Fisch",
                                   "Blume", "Fleisch", "Salz", "Pelz" };
     std::string bezeichnung;
     int seriennummer;
@@ -39,6 +40,15 @@ public:
         this->right = nullptr;
     };
 
+    Ware(std::string bezeichnung, int seriennummer, double gewicht, double einkaufspreis, double verkaufspreis,
+         int prio) : bezeichnung(std::move(bezeichnung)), seriennummer(seriennummer), gewicht(gewicht),
+    einkaufspreis(einkaufspreis), verkaufspreis(verkaufspreis){
+        this->priority = prio;
+        this->key = nullptr;
+        this->left = nullptr;
+        this->right = nullptr;
+    };
+
     ~Ware() {};
 
     const std::string &getBezeichnung() const;
@@ -60,9 +70,5 @@ public:
     double getVerkaufspreis() const;
 
     void setVerkaufspreis(double verkaufspreis);
-
-    Ware* insert(Ware * value);
-
-    Ware* deleteItem(Ware * value);
 };
 #endif //AUFGABE_1_WARE_H
@@ -3,17 +3,14 @@
 #include <iomanip>
 #include <vector>
 #include "extendedBinaryTree.h"
+#include "treeFile.h"
 
 
 int main() {
 
     /*
-        Ich verstehe die Fragestellung nicht, wenn ich die Priorität schon hier, in der Main vergebe und somit die Objekte
-        in der richtigen Reihenfolge einspiele dann mach das alles keinen Sinn. Was soll dann die insert Funktion mit der
-        Prio überhaupt noch machen?
-        Da es für den Übungszettel auch nicht vorgesehen ist, eine Drehung vom Baum zu implementieren muss man die
-        Prio auch der Reihenfolge einspielen.
-        Ich sehe vor lauter Bäumen den Wald nicht mehr....
+        Der Baum ist ein Treap: sortiert nach Verkaufspreis, Heap-geordnet nach Prioritaet. Die Prioritaet bestimmt
+        ueber Rotationen die Form des Baumes, nicht die Reihenfolge in der eingefuegt wird.
      */
 
     Ware* waren[10];
@@ -37,20 +34,10 @@ int main() {
             i->getVerkaufspreis() << " Prio: " << i->priority << std::endl;
     }
 
-    Ware* temp;
-
     //Insert array to tree
+    BinaryTree christmasTree;
     for(auto & i : waren){
-        if(i->priority == 0){
-            temp = i;
-        }
-    }
-
-    BinaryTree christmasTree(temp);
-    for(auto & i : waren){
-        if(i->priority != 0){
-            christmasTree.insert(i,i->priority);
-        }
+        christmasTree.insert(i,i->priority);
     }
 
     //Testing different print orders and deleting leaf and/or nodes
@@ -59,15 +46,43 @@ int main() {
     std::cout << "\nPrint in Inorder \n" << christmasTree.printInorder() << std::endl;
     std::cout << "\nPrint in printPriority \n" << christmasTree.printPriority() << std::endl;
 
-    /*
-    //  --  Deletion of a leaf  --
-    christmasTree.deleteItem(waren[7]);
-    std::cout << "Leaf [7] deleted" << std::endl;
-    std::cout << "\nPrint in Preorder \n" << christmasTree.printPreorder() << std::endl;
-    //  --  Deletion of a node with two children  --
+    //  --  Split at 1000 and merge again  --
+    BinaryTree expensive = christmasTree.split(1000);
+    std::cout << "\nPrint cheaper than 1000 \n" << christmasTree.printInorder() << std::endl;
+    std::cout << "\nPrint 1000 and more \n" << expensive.printInorder() << std::endl;
+    christmasTree.merge(expensive);
+
+    //  --  Deletion of a node, the Ware itself stays valid  --
     christmasTree.deleteItem(waren[1]);
     std::cout << "Node [1] deleted" << std::endl;
-    std::cout << "\nPrint in Preorder \n" << christmasTree.printPreorder() << std::endl;
-     */
+    std::cout << "\nPrint in printPriority \n" << christmasTree.printPriority() << std::endl;
+
+    //  --  Cartesian tree build of one million sorted Ware with random priorities  --
+    std::vector<Ware*> warehouse(1000000);
+    for(int i = 0; i < (int)warehouse.size(); i++){
+        warehouse[i] = new Ware(std::rand());
+        warehouse[i]->setVerkaufspreis(i);
+    }
+    BinaryTree bigTree = BinaryTree::buildFromSorted(warehouse);
+    std::cout << "Built treap of " << warehouse.size() << " Ware with height " << bigTree.getHeight() << std::endl;
+    for(int i = 0; i < (int)warehouse.size(); i += 2){
+        bigTree.deleteItem(warehouse[i]);
+    }
+    std::cout << "Deleted every second Ware, height now " << bigTree.getHeight() << std::endl;
 
-}
\ No newline at end of file
+    //  --  Save the treap, search the mapped file directly and rebuild the treap from it  --
+    saveTree(bigTree, "priceTreap.bst");
+    MappedWareIndex mappedIndex("priceTreap.bst");
+    const WareRecord* record = mappedIndex.search(4711);
+    std::cout << "Mapped index with " << mappedIndex.size() << " records, Verkaufspreis 4711: "
+              << record->bezeichnung << " Prio: " << record->priority << std::endl;
+    BinaryTree reloaded = loadTree("priceTreap.bst");
+    std::cout << "Reloaded treap, height " << reloaded.getHeight() << std::endl;
+
+    for(auto & i : warehouse){
+        delete i;
+    }
+    for(auto & i : waren){
+        delete i;
+    }
+}
@@ -0,0 +1,67 @@
+#ifndef AUFGABE_6_2_TREEFILE_H
+#define AUFGABE_6_2_TREEFILE_H
+
+#include <cstdint>
+#include <cstddef>
+#include <string>
+#include "extendedBinaryTree.h"
+
+/*  --
+    Tree file layout (native byte order):
+        header      TreeFileHeader
+        records     one WareRecord per node in in-order, i.e. sorted by Verkaufspreis
+        structure   2 bits per node in preorder: bit 0 = node has a left child, bit 1 = node has a right child
+    Because the records are sorted, the mapped file can be searched directly as a read-only index.
+    The structure bits rebuild exactly the saved shape in one linear pass, without a single comparison or rotation;
+    the stored priorities keep the heap order of the treap.
+--  */
+struct TreeFileHeader {
+    char magic[4];
+    uint32_t recordSize;
+    uint64_t nodeCount;
+};
+
+struct WareRecord {
+    char bezeichnung[24];       //  zero terminated
+    int32_t seriennummer;
+    int32_t priority;
+    double gewicht;
+    double einkaufspreis;
+    double verkaufspreis;
+};
+
+//  Read-only memory mapping of a whole file, unmapped in the destructor
+class MappedFile {
+    public:
+        explicit MappedFile(const std::string& path);
+        MappedFile(const MappedFile&) = delete;
+        MappedFile& operator=(const MappedFile&) = delete;
+        ~MappedFile();
+
+        const unsigned char* getData() const;
+        size_t getSize() const;
+
+    private:
+        const unsigned char* data;
+        size_t size;
+};
+
+//  The mapped records used as a sorted array, lookups by binary search without building any tree
+class MappedWareIndex {
+    public:
+        explicit MappedWareIndex(const std::string& path);
+
+        size_t size() const;
+        const WareRecord& operator[](size_t index) const;
+        const WareRecord* search(double verkaufspreis) const;   //  first record with this price, nullptr if none
+
+    private:
+        MappedFile file;
+        const WareRecord* records;
+        size_t count;
+};
+
+void saveTree(const BinaryTree& tree, const std::string& path);     //  throws ErrorTreeFile
+BinaryTree loadTree(const std::string& path);                       //  throws ErrorTreeFile, the caller owns the Ware
+
+#endif //AUFGABE_6_2_TREEFILE_H
@@ -0,0 +1,18 @@
+#include "benchmark.h"
+#include "avlMap.h"
+
+//  AvlMap<int, int> from Aufgabe_2_3, iterative insert and erase without parent pointers
+struct AvlMapAdapter {
+    static constexpr const char* name = "AvlMap";
+    static bool feasible(Order, size_t) { return true; }
+
+    AvlMap<int, int> map;
+
+    void insert(int key) { this->map.insert({key, key}); }
+    bool contains(int key) { return this->map.contains(key); }
+    void erase(int key) { this->map.erase(key); }
+};
+
+int main(int argc, char* argv[]) {
+    return runBenchmark<AvlMapAdapter>(argc, argv);
+}
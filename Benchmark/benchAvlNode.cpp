@@ -0,0 +1,19 @@
+#include "benchmark.h"
+#include "extendedAvlTree.h"
+
+//  AvlNode from Aufgabe_2_3, recursive insert and delete on the root that is passed around
+struct AvlNodeAdapter {
+    static constexpr const char* name = "AvlNode";
+    static bool feasible(Order, size_t) { return true; }
+
+    AvlNode* root = nullptr;
+
+    void insert(int key) { this->root = AvlNode::insert(this->root, key); }
+    bool contains(int key) { return AvlNode::search(this->root, key) != nullptr; }
+    void erase(int key) { this->root = AvlNode::deleteItem(this->root, key); }
+};
+
+//  the process ends right after the run, so none of the structures is torn down
+int main(int argc, char* argv[]) {
+    return runBenchmark<AvlNodeAdapter>(argc, argv);
+}
@@ -0,0 +1,23 @@
+#include "benchmark.h"
+#include "extendedBinaryTree.h"
+
+/*  Unbalanced BinaryTree of Ware from Aufgabe_2_1, the key is the Verkaufspreis. Sorted and zig-zag input
+    degenerate it to a list, and equal prices (zipf) pile up in one chain, so only random keys scale.
+ */
+struct BinaryTreeAdapter {
+    static constexpr const char* name = "BinaryTree";
+    static bool feasible(Order order, size_t size) { return order == Order::Random || size <= 50000; }
+
+    BinaryTree tree;
+
+    void insert(int key) { this->tree.insert(new Ware("Bench", 0, 0, 0, key)); }
+    bool contains(int key) { return this->tree.search((double)key) != nullptr; }
+    void erase(int key) {
+        Ware probe("Bench", 0, 0, 0, key);
+        this->tree.deleteItem(&probe);
+    }
+};
+
+int main(int argc, char* argv[]) {
+    return runBenchmark<BinaryTreeAdapter>(argc, argv);
+}
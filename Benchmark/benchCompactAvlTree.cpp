@@ -0,0 +1,18 @@
+#include "benchmark.h"
+#include "compactAvlTree.h"
+
+//  CompactAvlTree from Aufgabe_2_3, 12 byte nodes in one arena
+struct CompactAvlTreeAdapter {
+    static constexpr const char* name = "CompactAvlTree";
+    static bool feasible(Order, size_t) { return true; }
+
+    CompactAvlTree tree;
+
+    void insert(int key) { this->tree.insert(key); }
+    bool contains(int key) { return this->tree.contains(key); }
+    void erase(int key) { this->tree.deleteItem(key); }
+};
+
+int main(int argc, char* argv[]) {
+    return runBenchmark<CompactAvlTreeAdapter>(argc, argv);
+}
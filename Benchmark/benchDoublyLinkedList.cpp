@@ -0,0 +1,25 @@
+#include "benchmark.h"
+#include "doublyLinkedList.h"
+
+//  Sorted DoublyLinkedList from Aufgabe_2_2: every operation walks the list, O(n)
+struct DoublyLinkedListAdapter {
+    static constexpr const char* name = "DoublyLinkedList";
+    static bool feasible(Order, size_t size) { return size <= 50000; }
+
+    DoublyLinkedList list;
+
+    void insert(int key) { this->list.insertSorted(key); }
+    bool contains(int key) {
+        for(ExtendedListItem* item = this->list.head; item != nullptr && item->key <= key; item = item->next) {
+            if(item->key == key) {
+                return true;
+            }
+        }
+        return false;
+    }
+    void erase(int key) { this->list.deleteItem(key); }
+};
+
+int main(int argc, char* argv[]) {
+    return runBenchmark<DoublyLinkedListAdapter>(argc, argv);
+}
@@ -0,0 +1,20 @@
+#include "benchmark.h"
+#include "doublyLinkedList.h"
+
+//  DoublyLinkedList from Aufgabe_2_2 with the skip-list index: expected O(log n) per operation
+struct IndexedListAdapter {
+    static constexpr const char* name = "IndexedList";
+    static bool feasible(Order, size_t) { return true; }
+
+    DoublyLinkedList list;
+
+    IndexedListAdapter() { this->list.buildIndex(); }
+
+    void insert(int key) { this->list.insertSorted(key); }
+    bool contains(int key) { return this->list.search(key) != nullptr; }
+    void erase(int key) { this->list.deleteItem(key); }
+};
+
+int main(int argc, char* argv[]) {
+    return runBenchmark<IndexedListAdapter>(argc, argv);
+}
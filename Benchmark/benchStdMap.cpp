@@ -0,0 +1,18 @@
+#include "benchmark.h"
+#include <map>
+
+//  std::map<int, int> as the reference for AvlMap
+struct StdMapAdapter {
+    static constexpr const char* name = "std::map";
+    static bool feasible(Order, size_t) { return true; }
+
+    std::map<int, int> map;
+
+    void insert(int key) { this->map.insert({key, key}); }
+    bool contains(int key) { return this->map.count(key) != 0; }
+    void erase(int key) { this->map.erase(key); }
+};
+
+int main(int argc, char* argv[]) {
+    return runBenchmark<StdMapAdapter>(argc, argv);
+}
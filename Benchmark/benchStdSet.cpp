@@ -0,0 +1,18 @@
+#include "benchmark.h"
+#include <set>
+
+//  std::set<int> as the reference
+struct StdSetAdapter {
+    static constexpr const char* name = "std::set";
+    static bool feasible(Order, size_t) { return true; }
+
+    std::set<int> set;
+
+    void insert(int key) { this->set.insert(key); }
+    bool contains(int key) { return this->set.count(key) != 0; }
+    void erase(int key) { this->set.erase(key); }
+};
+
+int main(int argc, char* argv[]) {
+    return runBenchmark<StdSetAdapter>(argc, argv);
+}
@@ -0,0 +1,23 @@
+#include "benchmark.h"
+#include "extendedBinaryTree.h"
+
+//  Treap of Ware from Aufgabe_6_2 with random priorities, the key is the Verkaufspreis
+struct TreapAdapter {
+    static constexpr const char* name = "Treap";
+    static bool feasible(Order, size_t) { return true; }
+
+    BinaryTree tree;
+
+    void insert(int key) { this->tree.insert(new Ware("Bench", 0, 0, 0, key, 0)); }
+    bool contains(int key) { return this->tree.search((double)key) != nullptr; }
+    void erase(int key) {
+        Ware* ware = this->tree.search((double)key);
+        if(ware != nullptr) {
+            delete this->tree.deleteItem(ware);
+        }
+    }
+};
+
+int main(int argc, char* argv[]) {
+    return runBenchmark<TreapAdapter>(argc, argv);
+}
@@ -0,0 +1,18 @@
+#include "benchmark.h"
+#include "unrolledLinkedList.h"
+
+//  UnrolledLinkedList from Aufgabe_2_2: still O(n) per operation, but it hops over n / 32 nodes and binary searches one
+struct UnrolledListAdapter {
+    static constexpr const char* name = "UnrolledList";
+    static bool feasible(Order, size_t size) { return size <= 200000; }
+
+    UnrolledLinkedList list;
+
+    void insert(int key) { this->list.insertSorted(key); }
+    bool contains(int key) { return this->list.contains(key); }
+    void erase(int key) { this->list.deleteItem(key); }
+};
+
+int main(int argc, char* argv[]) {
+    return runBenchmark<UnrolledListAdapter>(argc, argv);
+}
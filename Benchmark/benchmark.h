@@ -0,0 +1,385 @@
+#ifndef BENCHMARK_BENCHMARK_H
+#define BENCHMARK_BENCHMARK_H
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+/*  --
+    Driver shared by all bench* executables, one executable per ordered structure. Every executable wraps its
+    structure in an adapter
+
+        struct Adapter {
+            static constexpr const char* name = "...";
+            static bool feasible(Order order, size_t size);    //  false where a run would take quadratic time
+            void insert(int key);
+            bool contains(int key);
+            void erase(int key);
+        };
+
+    and its main returns runBenchmark<Adapter>(argc, argv).
+
+    Usage: bench<Structure> [--size N] [--ops N] [--order random|sequential|zipf|adversarial|all]
+                            [--mix lookup|delete|mixed|all]
+        --size      keys inserted in the first phase (default 100000, up to 10^8)
+        --ops       operations in the second phase (default: size)
+        --order     order of the inserted keys:
+                        random      a random permutation of 0 .. size-1
+                        sequential  ascending
+                        zipf        drawn from a Zipf distribution (theta 0.99, scrambled), with duplicates
+                        adversarial zig-zag from both ends (0, size-1, 1, size-2, ...), the worst case for
+                                    plain BSTs and double rotations for AVL trees
+        --mix       operations of the second phase in percent lookup/insert/delete:
+                        lookup 90/5/5, delete 10/10/80, mixed 50/25/25
+
+    With "all" (the default) every combination runs in its own child process, so every row starts with a fresh
+    heap and reports its own peak RSS. Each run prints one row for the insert phase and one for the operation
+    mix: throughput, latency percentiles of every sampled operation (about 10^5 samples per phase) and
+    peak RSS of the process, plus the part of it allocated after the workload was generated.
+    Output of the structures themselves (e.g. "Item not found!") is discarded while measuring.
+--  */
+enum class Order { Random, Sequential, Zipf, Adversarial };
+enum class Mix { LookupHeavy, DeleteHeavy, Mixed };
+
+namespace bench {
+
+    struct MixRatio {
+        int lookup;     //  percent
+        int insert;
+    };
+
+    inline const char* orderName(Order order) {
+        switch(order) {
+            case Order::Random: return "random";
+            case Order::Sequential: return "sequential";
+            case Order::Zipf: return "zipf";
+            case Order::Adversarial: return "adversarial";
+        }
+        return "";
+    }
+
+    inline const char* mixName(Mix mix) {
+        switch(mix) {
+            case Mix::LookupHeavy: return "lookup";
+            case Mix::DeleteHeavy: return "delete";
+            case Mix::Mixed: return "mixed";
+        }
+        return "";
+    }
+
+    inline MixRatio mixRatio(Mix mix) {
+        switch(mix) {
+            case Mix::LookupHeavy: return {90, 5};
+            case Mix::DeleteHeavy: return {10, 10};
+            case Mix::Mixed: return {50, 25};
+        }
+        return {100, 0};
+    }
+
+    //  a large prime: i * permutationPrime % n runs through 0 .. n-1 exactly once for i = 0 .. n-1 (n < prime)
+    const uint64_t permutationPrime = 2654435761u;
+
+    /*  Zipf distributed ranks 0 .. items-1 (Gray et al., "Quickly generating billion-record synthetic databases",
+        as used by YCSB). Only zeta(items) needs O(items) time once, every draw is O(1).
+     */
+    class ZipfGenerator {
+        public:
+            ZipfGenerator(uint64_t items, double theta) : items(items), theta(theta) {
+                double zeta2 = 1.0 + std::pow(0.5, theta);
+                this->zetaN = 0;
+                for(uint64_t i = 1; i <= items; i++) {
+                    this->zetaN += 1.0 / std::pow((double)i, theta);
+                }
+                this->alpha = 1.0 / (1.0 - theta);
+                this->eta = (1.0 - std::pow(2.0 / (double)items, 1.0 - theta)) / (1.0 - zeta2 / this->zetaN);
+            }
+
+            template<typename Generator>
+            uint64_t next(Generator& generator) {
+                double u = std::uniform_real_distribution<double>(0.0, 1.0)(generator);
+                double uz = u * this->zetaN;
+                if(uz < 1.0) {
+                    return 0;
+                }
+                if(uz < 1.0 + std::pow(0.5, this->theta)) {
+                    return 1;
+                }
+                auto rank = (uint64_t)((double)this->items * std::pow(this->eta * u - this->eta + 1.0, this->alpha));
+                return rank < this->items ? rank : this->items - 1;
+            }
+
+        private:
+            uint64_t items;
+            double theta;
+            double zetaN;
+            double alpha;
+            double eta;
+    };
+
+    inline std::vector<int> generateKeys(Order order, size_t count, std::mt19937_64& generator) {
+        std::vector<int> keys(count);
+        switch(order) {
+            case Order::Random:
+                for(size_t i = 0; i < count; i++) {
+                    keys[i] = (int)i;
+                }
+                std::shuffle(keys.begin(), keys.end(), generator);
+                break;
+            case Order::Sequential:
+                for(size_t i = 0; i < count; i++) {
+                    keys[i] = (int)i;
+                }
+                break;
+            case Order::Zipf: {
+                //  scrambled: the hot ranks are spread over the key range instead of being the smallest keys
+                ZipfGenerator zipf(count, 0.99);
+                for(size_t i = 0; i < count; i++) {
+                    keys[i] = (int)(zipf.next(generator) * permutationPrime % count);
+                }
+                break;
+            }
+            case Order::Adversarial:
+                for(size_t i = 0; i < count; i++) {
+                    keys[i] = (int)(i % 2 == 0 ? i / 2 : count - 1 - i / 2);
+                }
+                break;
+        }
+        return keys;
+    }
+
+    inline size_t currentRss() {
+        long pages = 0;
+        long resident = 0;
+        FILE* statm = std::fopen("/proc/self/statm", "r");
+        if(statm != nullptr) {
+            if(std::fscanf(statm, "%ld %ld", &pages, &resident) != 2) {
+                resident = 0;
+            }
+            std::fclose(statm);
+        }
+        return (size_t)resident * (size_t)sysconf(_SC_PAGESIZE);
+    }
+
+    inline size_t peakRss() {
+        struct rusage usage{};
+        getrusage(RUSAGE_SELF, &usage);
+        return (size_t)usage.ru_maxrss * 1024;     //  kilobytes on Linux
+    }
+
+    struct PhaseResult {
+        size_t operations = 0;
+        double seconds = 0;
+        std::vector<uint32_t> samples;      //  nanoseconds
+    };
+
+    //  runs operation(i) for i = 0 .. count-1 and times every sampleEvery-th call on its own
+    template<typename Operation>
+    PhaseResult runPhase(size_t count, Operation operation) {
+        PhaseResult result;
+        size_t sampleEvery = std::max<size_t>(1, count / 100000);
+        result.samples.reserve(count / sampleEvery + 1);
+
+        auto start = std::chrono::steady_clock::now();
+        for(size_t i = 0; i < count; i++) {
+            if(i % sampleEvery == 0) {
+                auto before = std::chrono::steady_clock::now();
+                operation(i);
+                auto after = std::chrono::steady_clock::now();
+                result.samples.push_back(
+                        (uint32_t)std::chrono::duration_cast<std::chrono::nanoseconds>(after - before).count());
+            } else {
+                operation(i);
+            }
+        }
+        auto end = std::chrono::steady_clock::now();
+        result.operations = count;
+        result.seconds = std::chrono::duration<double>(end - start).count();
+        return result;
+    }
+
+    inline uint32_t percentile(std::vector<uint32_t>& sorted, double fraction) {
+        if(sorted.empty()) {
+            return 0;
+        }
+        size_t index = (size_t)(fraction * (double)(sorted.size() - 1));
+        return sorted[index];
+    }
+
+    inline void printHeader() {
+        std::cout << std::left << std::setw(18) << "structure" << std::setw(12) << "order" << std::setw(8) << "mix"
+                  << std::right << std::setw(11) << "size" << "  " << std::left << std::setw(8) << "phase"
+                  << std::right << std::setw(10) << "Mops/s" << std::setw(9) << "p50 ns" << std::setw(9) << "p90 ns"
+                  << std::setw(9) << "p99 ns" << std::setw(10) << "p99.9 ns" << std::setw(11) << "max ns"
+                  << std::setw(11) << "peak MB" << std::setw(11) << "struct MB" << std::endl;
+    }
+
+    inline void printRow(const char* structure, Order order, Mix mix, size_t size, const char* phase,
+                         PhaseResult& result, size_t baselineRss) {
+        std::sort(result.samples.begin(), result.samples.end());
+        size_t peak = peakRss();
+        std::cout << std::left << std::setw(18) << structure << std::setw(12) << orderName(order)
+                  << std::setw(8) << mixName(mix) << std::right << std::setw(11) << size << "  " << std::left
+                  << std::setw(8) << phase << std::right << std::fixed << std::setprecision(3) << std::setw(10)
+                  << (result.seconds > 0 ? (double)result.operations / result.seconds / 1e6 : 0.0)
+                  << std::setw(9) << percentile(result.samples, 0.5) << std::setw(9) << percentile(result.samples, 0.9)
+                  << std::setw(9) << percentile(result.samples, 0.99) << std::setw(10) << percentile(result.samples, 0.999)
+                  << std::setw(11) << (result.samples.empty() ? 0 : result.samples.back())
+                  << std::setprecision(1) << std::setw(11) << (double)peak / (1 << 20)
+                  << std::setw(11) << (double)(peak > baselineRss ? peak - baselineRss : 0) / (1 << 20) << std::endl;
+    }
+
+    //  keeps the results of contains() alive, so the lookups cannot be optimised away
+    inline volatile size_t sink = 0;
+
+    template<typename Adapter>
+    void runOne(Order order, Mix mix, size_t size, size_t operations) {
+        if(!Adapter::feasible(order, size)) {
+            std::cout << std::left << std::setw(18) << Adapter::name << std::setw(12) << orderName(order)
+                      << std::setw(8) << mixName(mix) << std::right << std::setw(11) << size
+                      << "  skipped, quadratic for this order and size" << std::endl;
+            return;
+        }
+
+        MixRatio ratio = mixRatio(mix);
+        std::mt19937_64 generator(20220527);
+        size_t extraInserts = operations * ratio.insert / 100 + 1;
+        std::vector<int> keys = generateKeys(order, size + extraInserts, generator);
+        size_t baselineRss = currentRss();
+
+        Adapter structure;
+        std::streambuf* output = std::cout.rdbuf(nullptr);
+        PhaseResult insertPhase = runPhase(size, [&](size_t i) { structure.insert(keys[i]); });
+
+        //  second phase: lookups hit a random key inserted so far (maybe deleted since), inserts take the next
+        //  unused key, deletes walk through the first size keys in a fixed pseudo random order
+        size_t inserted = size;
+        size_t deleted = 0;
+        uint64_t state = generator();
+        size_t hits = 0;
+        PhaseResult mixPhase = runPhase(operations, [&](size_t) {
+            state ^= state << 13;
+            state ^= state >> 7;
+            state ^= state << 17;
+            int choice = (int)(state % 100);
+            if(choice >= ratio.lookup && choice < ratio.lookup + ratio.insert && inserted < keys.size()) {
+                structure.insert(keys[inserted++]);
+            } else if(choice >= ratio.lookup + ratio.insert && deleted < size) {
+                structure.erase(keys[deleted++ * permutationPrime % size]);
+            } else if(inserted > 0) {
+                hits += structure.contains(keys[(state >> 32) % inserted]);
+            }
+        });
+        std::cout.rdbuf(output);
+        std::cout.clear();
+        sink = sink + hits;
+
+        printRow(Adapter::name, order, mix, size, "insert", insertPhase, baselineRss);
+        printRow(Adapter::name, order, mix, size, mixName(mix), mixPhase, baselineRss);
+    }
+
+    //  runs the executable again with one order and one mix and waits for it
+    inline void runChild(const std::vector<std::string>& arguments) {
+        std::cout.flush();
+        pid_t pid = fork();
+        if(pid == 0) {
+            std::vector<char*> argv;
+            for(const std::string& argument : arguments) {
+                argv.push_back(const_cast<char*>(argument.c_str()));
+            }
+            argv.push_back(nullptr);
+            execv("/proc/self/exe", argv.data());
+            std::perror("execv");
+            _exit(1);
+        }
+        int status = 0;
+        waitpid(pid, &status, 0);
+        if(!WIFEXITED(status) || WEXITSTATUS(status) != 0) {
+            std::cout << "run " << arguments[4] << " / " << arguments[6] << " failed" << std::endl;
+        }
+    }
+
+}
+
+template<typename Adapter>
+int runBenchmark(int argc, char* argv[]) {
+    using namespace bench;
+    size_t size = 100000;
+    size_t operations = 0;
+    std::string orderArgument = "all";
+    std::string mixArgument = "all";
+    bool header = true;
+
+    for(int i = 1; i < argc; i++) {
+        std::string argument = argv[i];
+        bool hasValue = i + 1 < argc;
+        if(argument == "--size" && hasValue) {
+            size = std::stoull(argv[++i]);
+        } else if(argument == "--ops" && hasValue) {
+            operations = std::stoull(argv[++i]);
+        } else if(argument == "--order" && hasValue) {
+            orderArgument = argv[++i];
+        } else if(argument == "--mix" && hasValue) {
+            mixArgument = argv[++i];
+        } else if(argument == "--noHeader") {
+            header = false;
+        } else {
+            std::cerr << "Usage: " << argv[0] << " [--size N] [--ops N] "
+                      << "[--order random|sequential|zipf|adversarial|all] [--mix lookup|delete|mixed|all]\n";
+            return 1;
+        }
+    }
+    if(operations == 0) {
+        operations = size;
+    }
+    if(size == 0 || size > 2000000000) {
+        std::cerr << "--size has to be between 1 and 2 * 10^9\n";
+        return 1;
+    }
+
+    const Order orders[] = {Order::Random, Order::Sequential, Order::Zipf, Order::Adversarial};
+    const Mix mixes[] = {Mix::LookupHeavy, Mix::DeleteHeavy, Mix::Mixed};
+    std::vector<Order> selectedOrders;
+    std::vector<Mix> selectedMixes;
+    for(Order order : orders) {
+        if(orderArgument == "all" || orderArgument == orderName(order)) {
+            selectedOrders.push_back(order);
+        }
+    }
+    for(Mix mix : mixes) {
+        if(mixArgument == "all" || mixArgument == mixName(mix)) {
+            selectedMixes.push_back(mix);
+        }
+    }
+    if(selectedOrders.empty() || selectedMixes.empty()) {
+        std::cerr << "Unknown order or mix\n";
+        return 1;
+    }
+
+    if(header) {
+        printHeader();
+    }
+    if(selectedOrders.size() == 1 && selectedMixes.size() == 1) {
+        runOne<Adapter>(selectedOrders[0], selectedMixes[0], size, operations);
+        return 0;
+    }
+    for(Order order : selectedOrders) {
+        for(Mix mix : selectedMixes) {
+            runChild({argv[0], "--size", std::to_string(size), "--order", orderName(order), "--mix", mixName(mix),
+                      "--ops", std::to_string(operations), "--noHeader"});
+        }
+    }
+    return 0;
+}
+
+#endif //BENCHMARK_BENCHMARK_H